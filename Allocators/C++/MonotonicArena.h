@@ -0,0 +1,237 @@
+/// \file   MonotonicArena.h
+/// \brief  A monotonic arena and an allocator that draws memory from it.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_MONOTONIC_ARENA
+#define INC_MONOTONIC_ARENA
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "BulkRelease.h"
+
+/// \brief  A region of memory from which objects are allocated by bumping a
+///         pointer, and which is released all at once.
+///
+/// Memory is obtained from the system in blocks. Each allocation is carved
+/// from the current block; when the block is exhausted a new block, twice
+/// the size of the previous one, is obtained. Individual allocations are
+/// never freed. Instead, \c reset releases every allocation in a single
+/// operation whose cost depends only on the number of blocks, not on the
+/// number of objects allocated.
+///
+/// Objects allocated from an arena are not destroyed when the arena is
+/// reset, so an arena is best suited to trivially destructible types, or to
+/// objects whose destructors have already run.
+class MonotonicArena
+{
+public:
+    /// \brief  Construct an arena whose first block holds the given number
+    ///         of bytes. No memory is allocated until the first allocation.
+    explicit MonotonicArena(size_t initial_block_size = 4096) noexcept
+      : _next_block_size{initial_block_size < min_block_size() ? min_block_size() : initial_block_size}
+    {
+    }
+
+    MonotonicArena(const MonotonicArena &) = delete;
+    MonotonicArena & operator=(const MonotonicArena &) = delete;
+
+    /// \brief  Destroy the arena, releasing all of its memory.
+    ~MonotonicArena()
+    {
+        release_blocks();
+    }
+
+    /// \brief  Allocate memory from the arena.
+    ///
+    /// \param bytes        The number of bytes required.
+    /// \param alignment    The required alignment, which must be a power of two.
+    ///
+    /// \return A pointer to the allocated memory.
+    ///
+    /// \throw std::bad_alloc if a new block could not be obtained.
+    void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        std::uintptr_t  current{reinterpret_cast<std::uintptr_t>(_current)};
+        std::uintptr_t  aligned{(current + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1)};
+
+        if (_current == nullptr || aligned + bytes > reinterpret_cast<std::uintptr_t>(_end))
+        {
+            add_block(bytes + alignment);
+            current = reinterpret_cast<std::uintptr_t>(_current);
+            aligned = (current + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        }
+
+        _current = reinterpret_cast<char *>(aligned + bytes);
+        _bytes_used += bytes;
+
+        return reinterpret_cast<void *>(aligned);
+    }
+
+    /// \brief  Individual allocations are not freed; this function does nothing.
+    void deallocate(void *, size_t) noexcept
+    {
+    }
+
+    /// \brief  Release every allocation made from the arena.
+    ///
+    /// The most recently obtained block, which is also the largest, is kept
+    /// for the allocations that follow; every other block is returned to the
+    /// system.
+    void reset() noexcept
+    {
+        if (_blocks == nullptr)
+            return;
+
+        block  *kept{_blocks};
+
+        _blocks = kept->_previous;
+        release_blocks();
+
+        kept->_previous = nullptr;
+        _blocks = kept;
+        _current = reinterpret_cast<char *>(kept + 1);
+        _end = reinterpret_cast<char *>(kept) + _next_block_size / 2;
+        _bytes_reserved = _next_block_size / 2;
+    }
+
+    /// \brief  Return the number of bytes handed out since the arena was
+    ///         constructed or last reset.
+    size_t bytes_used() const noexcept
+    {
+        return _bytes_used;
+    }
+
+    /// \brief  Return the number of bytes obtained from the system in blocks.
+    size_t bytes_reserved() const noexcept
+    {
+        return _bytes_reserved;
+    }
+
+private:
+    // Each block begins with a header linking it to the previously
+    // allocated block.
+    struct block
+    {
+        block  *_previous;
+    };
+
+    static constexpr size_t min_block_size() noexcept
+    {
+        return 256;
+    }
+
+    // Obtain a new block large enough for an allocation of the given size.
+    void add_block(size_t required)
+    {
+        size_t  size{_next_block_size};
+
+        while (size < required + sizeof(block))
+            size *= 2;
+
+        block  *new_block{static_cast<block *>(::operator new(size))};
+
+        new_block->_previous = _blocks;
+        _blocks = new_block;
+        _current = reinterpret_cast<char *>(new_block + 1);
+        _end = reinterpret_cast<char *>(new_block) + size;
+        _bytes_reserved += size;
+        _next_block_size = size * 2;
+    }
+
+    void release_blocks() noexcept
+    {
+        while (_blocks != nullptr)
+        {
+            block  *previous{_blocks->_previous};
+
+            ::operator delete(_blocks);
+            _blocks = previous;
+        }
+
+        _current = _end = nullptr;
+        _bytes_used = _bytes_reserved = 0;
+    }
+
+// Instance data
+private:
+    block  *_blocks{nullptr};       ///< Most recently allocated block
+    char   *_current{nullptr};      ///< Next free byte in the current block
+    char   *_end{nullptr};          ///< End of the current block
+    size_t  _next_block_size;       ///< Size of the next block to be obtained
+    size_t  _bytes_used{0};         ///< Bytes handed out
+    size_t  _bytes_reserved{0};     ///< Bytes obtained in blocks
+};
+
+/// \brief  A standard-conforming allocator that obtains memory from a
+///         MonotonicArena.
+///
+/// Containers that accept an allocator, such as SingleLinkedList,
+/// DoubleLinkedList and Stack, can be given an ArenaAllocator so that all of
+/// their nodes come from one arena. Deallocation does nothing; the memory is
+/// reclaimed when the arena is reset or destroyed. The arena must outlive
+/// every container that uses it.
+template<typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    /// \brief  Construct an allocator that draws memory from the given arena.
+    explicit ArenaAllocator(MonotonicArena &arena) noexcept
+      : _arena{&arena}
+    {
+    }
+
+    /// \brief  Construct an allocator for type \c T that shares the arena of
+    ///         an allocator for another type.
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept
+      : _arena{other.arena()}
+    {
+    }
+
+    /// \brief  Allocate uninitialized memory for \p count objects of type \c T.
+    T *allocate(size_t count)
+    {
+        return static_cast<T *>(_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// \brief  Does nothing; the memory is reclaimed when the arena is reset.
+    void deallocate(T *, size_t) noexcept
+    {
+    }
+
+    /// \brief  Return the arena from which memory is drawn.
+    MonotonicArena *arena() const noexcept
+    {
+        return _arena;
+    }
+
+// Instance data
+private:
+    MonotonicArena *_arena;     ///< The arena from which memory is drawn
+};
+
+/// \brief  Two ArenaAllocators are equal if they draw from the same arena.
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+{
+    return lhs.arena() == rhs.arena();
+}
+
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/// \brief  An arena reclaims every allocation when it is reset or destroyed.
+template<typename T>
+struct releases_in_bulk<ArenaAllocator<T>> : std::true_type
+{
+};
+
+#endif // INC_MONOTONIC_ARENA
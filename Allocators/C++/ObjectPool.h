@@ -0,0 +1,587 @@
+/// \file   ObjectPool.h
+/// \brief  Pools of fixed-size slots, and an allocator that draws from them.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_OBJECT_POOL
+#define INC_OBJECT_POOL
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "BulkRelease.h"
+
+/// \brief  A pool of equally sized slots of memory, handed out and taken
+///         back one at a time.
+///
+/// The free slots are kept on a stack threaded through the slots
+/// themselves: each free slot holds a pointer to the next. Taking a slot
+/// pops the top of the stack and returning one pushes it, so both take
+/// constant time and the slot handed out next is the one most recently
+/// returned, which is the most likely to still be in the cache.
+///
+/// Slots are carved from chunks obtained from the system, each chunk
+/// holding twice as many slots as the last, up to 4096. A chunk is carved
+/// only as its slots are first needed. The chunks are returned to the
+/// system when the pool is destroyed, whether or not their slots have been
+/// returned.
+///
+/// The slot size may be given to the constructor or, if it is zero, is
+/// taken from the first allocation. This suits a container whose
+/// allocator is rebound to a node type the caller cannot name. Allocations
+/// that do not fit in a slot are passed to \c operator \c new, so the pool
+/// can serve every allocation a container makes.
+///
+/// A SlotPool is not thread-safe; see ConcurrentSlotPool.
+class SlotPool
+{
+public:
+    /// \brief  Construct a pool of slots of the given size and alignment.
+    ///         No memory is allocated until the first allocation.
+    ///
+    /// \param slot_size            The size of each slot in bytes, or zero
+    ///                             to take it from the first allocation.
+    /// \param alignment            The alignment of each slot, a power of two.
+    /// \param initial_chunk_slots  The number of slots in the first chunk.
+    explicit SlotPool(size_t slot_size = 0,
+                      size_t alignment = alignof(std::max_align_t),
+                      size_t initial_chunk_slots = 64) noexcept
+      : _next_chunk_slots{initial_chunk_slots == 0 ? 1 : initial_chunk_slots}
+    {
+        if (slot_size != 0)
+            configure(slot_size, alignment);
+    }
+
+    SlotPool(const SlotPool &) = delete;
+    SlotPool & operator=(const SlotPool &) = delete;
+
+    /// \brief  Destroy the pool, returning all of its chunks to the system.
+    ~SlotPool()
+    {
+        while (_chunks != nullptr)
+        {
+            chunk  *previous{_chunks->_previous};
+
+            ::operator delete(_chunks, std::align_val_t(_alignment));
+            _chunks = previous;
+        }
+    }
+
+    /// \brief  Fix the size and alignment of the slots, if they have not
+    ///         been fixed already.
+    ///
+    /// The slot is made large enough to hold a pointer, and its size a
+    /// multiple of its alignment.
+    void configure(size_t bytes, size_t alignment) noexcept
+    {
+        if (_slot_size != 0)
+            return;
+
+        _alignment = alignment < alignof(free_slot) ? alignof(free_slot) : alignment;
+        _slot_size = round_up(bytes < sizeof(free_slot) ? sizeof(free_slot) : bytes, _alignment);
+    }
+
+    /// \brief  Determine whether an allocation fits in a slot.
+    bool fits(size_t bytes, size_t alignment) const noexcept
+    {
+        return bytes <= _slot_size && alignment <= _alignment;
+    }
+
+    /// \brief  Allocate memory, from a slot if it fits in one.
+    ///
+    /// \param bytes        The number of bytes required.
+    /// \param alignment    The required alignment, which must be a power of two.
+    ///
+    /// \return A pointer to the allocated memory.
+    ///
+    /// \throw std::bad_alloc if the memory could not be obtained.
+    void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        configure(bytes, alignment);
+
+        if (!fits(bytes, alignment))
+            return ::operator new(bytes, std::align_val_t(alignment));
+
+        return allocate_slot();
+    }
+
+    /// \brief  Free memory obtained from \c allocate with the same size and
+    ///         alignment.
+    void deallocate(void *memory, size_t bytes, size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        if (fits(bytes, alignment))
+            deallocate_slot(memory);
+        else
+            ::operator delete(memory, std::align_val_t(alignment));
+    }
+
+    /// \brief  Take a slot from the pool.
+    ///
+    /// The slot size must have been fixed.
+    ///
+    /// \throw std::bad_alloc if a new chunk could not be obtained.
+    void *allocate_slot()
+    {
+        void   *slot;
+
+        if (_free != nullptr)
+        {
+            slot = _free;
+            _free = _free->_next;
+        }
+        else
+        {
+            if (_next == _end)
+                add_chunk();
+            slot = _next;
+            _next += _slot_size;
+        }
+
+        ++_in_use;
+        return slot;
+    }
+
+    /// \brief  Return a slot to the pool, to be handed out next.
+    void deallocate_slot(void *slot) noexcept
+    {
+        _free = ::new (slot) free_slot{_free};
+        --_in_use;
+    }
+
+    /// \brief  Return the size of each slot, or zero if it is not yet fixed.
+    size_t slot_size() const noexcept
+    {
+        return _slot_size;
+    }
+
+    /// \brief  Return the number of slots handed out and not yet returned.
+    size_t slots_in_use() const noexcept
+    {
+        return _in_use;
+    }
+
+    /// \brief  Return the number of slots in the chunks obtained so far.
+    size_t slots_reserved() const noexcept
+    {
+        return _reserved;
+    }
+
+private:
+    // A free slot holds a pointer to the next free slot.
+    struct free_slot
+    {
+        free_slot  *_next;
+    };
+
+    // Each chunk begins with a header linking it to the previously
+    // obtained chunk.
+    struct chunk
+    {
+        chunk  *_previous;
+    };
+
+    static constexpr size_t max_chunk_slots{4096};
+
+    static size_t round_up(size_t bytes, size_t alignment) noexcept
+    {
+        return (bytes + alignment - 1) & ~(alignment - 1);
+    }
+
+    // Obtain a new chunk and make its slots the next to be carved.
+    void add_chunk()
+    {
+        const size_t    header{round_up(sizeof(chunk), _alignment)};
+        const size_t    slots{_next_chunk_slots};
+        chunk          *new_chunk{static_cast<chunk *>(::operator new(header + slots * _slot_size,
+                                                                      std::align_val_t(_alignment)))};
+
+        new_chunk->_previous = _chunks;
+        _chunks = new_chunk;
+        _next = reinterpret_cast<char *>(new_chunk) + header;
+        _end = _next + slots * _slot_size;
+        _reserved += slots;
+        _next_chunk_slots = slots * 2 < max_chunk_slots ? slots * 2 : max_chunk_slots;
+    }
+
+// Instance data
+private:
+    free_slot  *_free{nullptr};             ///< Top of the stack of free slots
+    char       *_next{nullptr};             ///< Next slot to be carved from the newest chunk
+    char       *_end{nullptr};              ///< End of the newest chunk
+    chunk      *_chunks{nullptr};           ///< Most recently obtained chunk
+    size_t      _slot_size{0};              ///< Size of each slot, or zero until fixed
+    size_t      _alignment{alignof(free_slot)};    ///< Alignment of each slot and chunk
+    size_t      _next_chunk_slots;          ///< Number of slots in the next chunk
+    size_t      _in_use{0};                 ///< Slots handed out
+    size_t      _reserved{0};               ///< Slots in all chunks
+};
+
+/// \brief  A pool of objects of one type, constructed in slots that are
+///         reused once the objects are released.
+///
+/// \tparam T   The type of the pooled objects.
+///
+/// Objects still acquired when the pool is destroyed are not destroyed;
+/// their memory is returned to the system with the pool's chunks.
+template<typename T>
+class ObjectPool
+{
+public:
+    /// \brief  Construct an empty pool. No memory is allocated until the
+    ///         first object is acquired.
+    ///
+    /// \param initial_chunk_slots  The number of objects in the first chunk.
+    explicit ObjectPool(size_t initial_chunk_slots = 64) noexcept
+      : _slots(sizeof(T), alignof(T), initial_chunk_slots)
+    {
+    }
+
+    /// \brief  Construct an object in a slot from the pool.
+    ///
+    /// \param args Arguments passed to the object's constructor.
+    /// \return A pointer to the new object.
+    ///
+    /// If the constructor throws an exception, the slot is returned to the
+    /// pool.
+    template<typename... Args>
+    T *acquire(Args &&...args)
+    {
+        void   *slot{_slots.allocate_slot()};
+
+        try
+        {
+            return ::new (slot) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            _slots.deallocate_slot(slot);
+            throw;
+        }
+    }
+
+    /// \brief  Destroy an object and return its slot to the pool.
+    ///
+    /// \param object   An object obtained from \c acquire.
+    void release(T *object) noexcept
+    {
+        object->~T();
+        _slots.deallocate_slot(object);
+    }
+
+    /// \brief  Return the number of objects acquired and not yet released.
+    size_t in_use() const noexcept
+    {
+        return _slots.slots_in_use();
+    }
+
+    /// \brief  Return the number of objects the pool's chunks can hold.
+    size_t reserved() const noexcept
+    {
+        return _slots.slots_reserved();
+    }
+
+// Instance data
+private:
+    SlotPool    _slots;     ///< The slots in which objects are constructed
+};
+
+/// \brief  A thread-safe pool of equally sized slots, with an optional
+///         cache of free slots for each thread.
+///
+/// The slots come from a SlotPool guarded by a mutex. With caching
+/// enabled, each thread keeps up to \c cache_slots free slots of its own,
+/// threaded through the slots like the pool's own free list. A thread
+/// takes and returns slots through its cache without locking, and moves
+/// half a cache of slots to or from the shared pool, under the lock, only
+/// when its cache runs empty or fills up. A slot freed by another thread
+/// than the one that took it simply joins the freeing thread's cache.
+///
+/// When a thread exits, its caches return their slots to their pools. A
+/// cache refers to its pool weakly, so destroying the ConcurrentSlotPool
+/// returns its chunks to the system at once, taking any cached slots with
+/// them, and each thread drops its cache for the pool the next time it
+/// looks for another.
+class ConcurrentSlotPool
+{
+public:
+    /// \brief  Construct a pool of slots of the given size and alignment.
+    ///
+    /// \param slot_size    The size of each slot in bytes, or zero to take
+    ///                     it from the first allocation.
+    /// \param alignment    The alignment of each slot, a power of two.
+    /// \param cache_slots  The most free slots each thread keeps, or zero
+    ///                     for no per-thread caches.
+    explicit ConcurrentSlotPool(size_t slot_size = 0,
+                                size_t alignment = alignof(std::max_align_t),
+                                size_t cache_slots = 64)
+      : _shared{std::make_shared<shared_state>(slot_size, alignment,
+                                               cache_slots == 1 ? 2 : cache_slots)}
+    {
+    }
+
+    ConcurrentSlotPool(const ConcurrentSlotPool &) = delete;
+    ConcurrentSlotPool & operator=(const ConcurrentSlotPool &) = delete;
+
+    /// \brief  Allocate memory, from a slot if it fits in one.
+    ///
+    /// \param bytes        The number of bytes required.
+    /// \param alignment    The required alignment, which must be a power of two.
+    ///
+    /// \return A pointer to the allocated memory.
+    ///
+    /// \throw std::bad_alloc if the memory could not be obtained.
+    void *allocate(size_t bytes, size_t alignment = alignof(std::max_align_t))
+    {
+        shared_state   &shared{*_shared};
+
+        if (!shared._configured.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock{shared._mutex};
+
+            shared._pool.configure(bytes, alignment);
+            shared._configured.store(true, std::memory_order_release);
+        }
+
+        if (shared._cache_slots == 0 || !shared._pool.fits(bytes, alignment))
+        {
+            std::lock_guard<std::mutex> lock{shared._mutex};
+
+            return shared._pool.allocate(bytes, alignment);
+        }
+
+        thread_cache   &cache{local_cache()};
+
+        if (cache._head == nullptr)
+            cache.refill(shared);
+
+        cached_slot    *slot{cache._head};
+
+        cache._head = slot->_next;
+        --cache._count;
+
+        return slot;
+    }
+
+    /// \brief  Free memory obtained from \c allocate with the same size and
+    ///         alignment.
+    void deallocate(void *memory, size_t bytes, size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        shared_state   &shared{*_shared};
+
+        if (shared._cache_slots == 0 || !shared._pool.fits(bytes, alignment))
+        {
+            std::lock_guard<std::mutex> lock{shared._mutex};
+
+            shared._pool.deallocate(memory, bytes, alignment);
+            return;
+        }
+
+        thread_cache   &cache{local_cache()};
+
+        cache._head = ::new (memory) cached_slot{cache._head};
+        if (++cache._count == shared._cache_slots)
+            cache.flush(shared, shared._cache_slots / 2);
+    }
+
+private:
+    // A free slot in a thread's cache holds a pointer to the next.
+    struct cached_slot
+    {
+        cached_slot    *_next;
+    };
+
+    // The pool shared by every thread.
+    struct shared_state
+    {
+        shared_state(size_t slot_size, size_t alignment, size_t cache_slots)
+          : _pool(slot_size, alignment),
+            _configured{slot_size != 0},
+            _cache_slots{cache_slots}
+        {}
+
+        std::mutex          _mutex;         ///< Guards the pool
+        SlotPool            _pool;          ///< The slots shared by every thread
+        std::atomic<bool>   _configured;    ///< Whether the slot size is fixed
+        const size_t        _cache_slots;   ///< Most free slots kept by a thread
+    };
+
+    // One thread's free slots for one pool.
+    struct thread_cache
+    {
+        explicit thread_cache(const std::shared_ptr<shared_state> &owner)
+          : _owner{owner},
+            _key{owner.get()}
+        {}
+
+        thread_cache(const thread_cache &) = delete;
+        thread_cache & operator=(const thread_cache &) = delete;
+
+        // Return the cached slots to the pool, unless it has been destroyed
+        // and its chunks with it.
+        ~thread_cache()
+        {
+            if (std::shared_ptr<shared_state> owner = _owner.lock())
+                flush(*owner, _count);
+        }
+
+        // Determine whether this is the cache for a live pool. The pool's
+        // address alone is not enough, since a new pool may be given the
+        // address of one that has been destroyed.
+        bool serves(const shared_state *shared) const noexcept
+        {
+            return _key == shared && !_owner.expired();
+        }
+
+        // Take half a cache of slots from the shared pool.
+        void refill(shared_state &owner)
+        {
+            std::lock_guard<std::mutex> lock{owner._mutex};
+
+            for (size_t n = owner._cache_slots / 2; n > 0; --n)
+            {
+                _head = ::new (owner._pool.allocate_slot()) cached_slot{_head};
+                ++_count;
+            }
+        }
+
+        // Return slots to the shared pool.
+        void flush(shared_state &owner, size_t count) noexcept
+        {
+            if (count == 0)
+                return;
+
+            std::lock_guard<std::mutex> lock{owner._mutex};
+
+            for (; count > 0; --count)
+            {
+                cached_slot    *slot{_head};
+
+                _head = slot->_next;
+                --_count;
+                owner._pool.deallocate_slot(slot);
+            }
+        }
+
+        std::weak_ptr<shared_state>     _owner;             ///< The pool the slots belong to
+        const shared_state             *_key;               ///< The address of the pool
+        cached_slot                    *_head{nullptr};     ///< Top of the stack of cached slots
+        size_t                          _count{0};          ///< Number of cached slots
+    };
+
+    // Return the calling thread's cache for this pool, creating it on the
+    // thread's first use of the pool. The most recently used cache is
+    // checked first, since a thread usually works with one pool at a time.
+    // Otherwise the caches of destroyed pools are dropped before the search.
+    thread_cache &local_cache()
+    {
+        thread_local std::vector<std::unique_ptr<thread_cache>> caches;
+        thread_local thread_cache                              *last{nullptr};
+
+        if (last != nullptr && last->serves(_shared.get()))
+            return *last;
+
+        caches.erase(std::remove_if(caches.begin(), caches.end(),
+                                    [](const std::unique_ptr<thread_cache> &cache)
+                                    {
+                                        return cache->_owner.expired();
+                                    }),
+                     caches.end());
+
+        for (auto &cache : caches)
+        {
+            if (cache->serves(_shared.get()))
+                return *(last = cache.get());
+        }
+
+        caches.push_back(std::make_unique<thread_cache>(_shared));
+        return *(last = caches.back().get());
+    }
+
+// Instance data
+private:
+    std::shared_ptr<shared_state>   _shared;    ///< The pool shared by every thread
+};
+
+/// \brief  A standard-conforming allocator that obtains memory from a
+///         SlotPool or ConcurrentSlotPool.
+///
+/// Containers that allocate their nodes one at a time, such as Stack,
+/// SingleLinkedList and DoubleLinkedList, can be given a PoolAllocator so
+/// that freed nodes are reused by the nodes that follow, in last-in
+/// first-out order. The pool's slot size is taken from the first
+/// allocation, which for these containers is a node; larger allocations
+/// are passed to \c operator \c new. The pool must outlive every container
+/// that uses it.
+///
+/// \tparam T       The type of the objects allocated.
+/// \tparam Pool    The type of the pool, SlotPool or ConcurrentSlotPool.
+template<typename T, typename Pool = SlotPool>
+class PoolAllocator
+{
+public:
+    using value_type = T;
+
+    /// \brief  Construct an allocator that draws memory from the given pool.
+    explicit PoolAllocator(Pool &pool) noexcept
+      : _pool{&pool}
+    {
+    }
+
+    /// \brief  Construct an allocator for type \c T that shares the pool of
+    ///         an allocator for another type.
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U, Pool> &other) noexcept
+      : _pool{other.pool()}
+    {
+    }
+
+    /// \brief  Allocate uninitialized memory for \p count objects of type \c T.
+    T *allocate(size_t count)
+    {
+        return static_cast<T *>(_pool->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /// \brief  Return memory obtained from \c allocate to the pool.
+    void deallocate(T *memory, size_t count) noexcept
+    {
+        _pool->deallocate(memory, count * sizeof(T), alignof(T));
+    }
+
+    /// \brief  Return the pool from which memory is drawn.
+    Pool *pool() const noexcept
+    {
+        return _pool;
+    }
+
+// Instance data
+private:
+    Pool   *_pool;      ///< The pool from which memory is drawn
+};
+
+/// \brief  Two PoolAllocators are equal if they draw from the same pool.
+template<typename T, typename U, typename Pool>
+bool operator==(const PoolAllocator<T, Pool> &lhs, const PoolAllocator<U, Pool> &rhs) noexcept
+{
+    return lhs.pool() == rhs.pool();
+}
+
+template<typename T, typename U, typename Pool>
+bool operator!=(const PoolAllocator<T, Pool> &lhs, const PoolAllocator<U, Pool> &rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+/// \brief  A pool returns all of its chunks to the system when it is
+///         destroyed, whether or not their slots have been freed.
+template<typename T, typename Pool>
+struct releases_in_bulk<PoolAllocator<T, Pool>> : std::true_type
+{
+};
+
+#endif // INC_OBJECT_POOL
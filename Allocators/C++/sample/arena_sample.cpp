@@ -0,0 +1,122 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <iostream>
+
+#include "../MonotonicArena.h"
+#include "../../../LinkedList/C++/SingleLinkedList.h"
+#include "../../../LinkedList/C++/DoubleLinkedList.h"
+#include "../../../Stack/C++/Stack.h"
+
+namespace {
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Build a list with the default allocator and with an arena, and compare
+// the time taken to tear each one down.
+template<template<typename, typename> class List>
+void benchmark_list(const char *name, int count)
+{
+    long long   build_ms;
+    long long   teardown_ms;
+
+    {
+        auto then = clock_type::now();
+        List<int, std::allocator<int>>  list;
+        for (int i = 0; i < count; ++i)
+            list.append(i);
+        build_ms = elapsed_ms(then);
+
+        then = clock_type::now();
+        list.erase();
+        teardown_ms = elapsed_ms(then);
+    }
+    std::cout << "  " << name << " with new/delete:  build " << build_ms
+              << " ms, erase " << teardown_ms << " ms\n";
+
+    MonotonicArena  arena;
+    {
+        auto then = clock_type::now();
+        List<int, ArenaAllocator<int>>  list{ArenaAllocator<int>(arena)};
+        for (int i = 0; i < count; ++i)
+            list.append(i);
+        build_ms = elapsed_ms(then);
+
+        then = clock_type::now();
+        list.release();
+        arena.reset();
+        teardown_ms = elapsed_ms(then);
+    }
+    std::cout << "  " << name << " with an arena:    build " << build_ms
+              << " ms, release and reset " << teardown_ms << " ms\n";
+}
+
+void benchmark_stack(int count)
+{
+    long long   build_ms;
+    long long   teardown_ms;
+
+    {
+        auto then = clock_type::now();
+        auto *stack = new Stack<int>;
+        for (int i = 0; i < count; ++i)
+            stack->push(i);
+        build_ms = elapsed_ms(then);
+
+        then = clock_type::now();
+        delete stack;
+        teardown_ms = elapsed_ms(then);
+    }
+    std::cout << "  Stack with new/delete:  build " << build_ms
+              << " ms, destroy " << teardown_ms << " ms\n";
+
+    MonotonicArena  arena;
+    {
+        auto then = clock_type::now();
+        Stack<int, ArenaAllocator<int>> stack{ArenaAllocator<int>(arena)};
+        for (int i = 0; i < count; ++i)
+            stack.push(i);
+        build_ms = elapsed_ms(then);
+
+        then = clock_type::now();
+        stack.release();
+        arena.reset();
+        teardown_ms = elapsed_ms(then);
+    }
+    std::cout << "  Stack with an arena:    build " << build_ms
+              << " ms, release and reset " << teardown_ms << " ms\n";
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    for (int count : {100000, 1000000, 10000000})
+    {
+        std::cout << "Teardown of " << count << " nodes\n";
+        benchmark_list<SingleLinkedList>("SingleLinkedList", count);
+        benchmark_list<DoubleLinkedList>("DoubleLinkedList", count);
+        benchmark_stack(count);
+    }
+
+    // An arena can be reused for request after request; after the first
+    // reset it no longer needs to obtain memory from the system.
+    MonotonicArena  arena;
+    auto then = clock_type::now();
+    for (int request = 0; request < 1000; ++request)
+    {
+        DoubleLinkedList<int, ArenaAllocator<int>>  list{ArenaAllocator<int>(arena)};
+
+        for (int i = 0; i < 1000; ++i)
+            list.append(i);
+        list.release();
+        arena.reset();
+    }
+    std::cout << "1000 request-scoped lists of 1000 nodes took " << elapsed_ms(then)
+              << " ms using " << arena.bytes_reserved() << " bytes of arena\n";
+}
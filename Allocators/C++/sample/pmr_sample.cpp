@@ -0,0 +1,113 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <iostream>
+#include <memory_resource>
+
+#include "../../../LinkedList/C++/SingleLinkedList.h"
+#include "../../../LinkedList/C++/DoubleLinkedList.h"
+#include "../../../Stack/C++/Stack.h"
+
+namespace {
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// These functions are not templates: one instantiation serves every
+// pmr list and stack, whatever memory resource it draws from.
+long long sum(pmr::DoubleLinkedList<int> &list)
+{
+    long long total = 0;
+
+    for (auto *node = list.head(); node; node = node->next())
+        total += node->data();
+
+    return total;
+}
+
+void fill(pmr::DoubleLinkedList<int> &list, int count)
+{
+    for (int i = 0; i < count; ++i)
+        list.append(i);
+}
+
+// Match brackets with a stack drawing from whatever resource it was given.
+bool balanced(const char *text, std::pmr::memory_resource *resource)
+{
+    pmr::Stack<char>    stack(resource);
+
+    for (; *text; ++text)
+    {
+        if (*text == '(' || *text == '[')
+        {
+            stack.push(*text);
+        }
+        else if (*text == ')' || *text == ']')
+        {
+            if (stack.is_empty() || stack.top() != (*text == ')' ? '(' : '['))
+                return false;
+            stack.pop();
+        }
+    }
+
+    return stack.is_empty();
+}
+
+void demonstrate_strategies()
+{
+    constexpr int   count = 1000000;
+
+    // A long-lived list draws from a pool, which recycles freed nodes.
+    std::pmr::unsynchronized_pool_resource  pool;
+    pmr::DoubleLinkedList<int>              long_lived(&pool);
+
+    auto then = clock_type::now();
+    fill(long_lived, count);
+    std::cout << "Filling a pooled list of " << count << " nodes took "
+              << elapsed_ms(then) << " ms, sum " << sum(long_lived) << '\n';
+
+    // A request-scoped list draws from a monotonic buffer and is discarded
+    // with it, in one step.
+    then = clock_type::now();
+    {
+        std::pmr::monotonic_buffer_resource request;
+        pmr::DoubleLinkedList<int>          scratch(&request);
+
+        fill(scratch, count);
+        std::cout << "Filling a monotonic list of " << count << " nodes took "
+                  << elapsed_ms(then) << " ms, sum " << sum(scratch) << '\n';
+
+        then = clock_type::now();
+        scratch.release();
+    }
+    std::cout << "Releasing the monotonic list and its resource took "
+              << elapsed_ms(then) << " ms\n";
+
+    // The default resource is the global heap.
+    pmr::SingleLinkedList<int>  ordinary;
+    ordinary.append(1);
+    ordinary.append(2);
+    std::cout << "A pmr list using the default resource holds " << ordinary.size()
+              << " elements\n";
+
+    // A small buffer on the stack serves short-lived containers without
+    // touching the heap until it is exhausted.
+    char                                buffer[1024];
+    std::pmr::monotonic_buffer_resource local(buffer, sizeof(buffer));
+
+    std::cout << "\"([()[]])\" is " << (balanced("([()[]])", &local) ? "" : "not ")
+              << "balanced\n";
+    std::cout << "\"([)]\" is " << (balanced("([)]", &pool) ? "" : "not ")
+              << "balanced\n";
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    demonstrate_strategies();
+}
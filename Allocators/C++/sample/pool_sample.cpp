@@ -0,0 +1,196 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../ObjectPool.h"
+#include "../../../LinkedList/C++/SingleLinkedList.h"
+#include "../../../LinkedList/C++/DoubleLinkedList.h"
+#include "../../../Stack/C++/Stack.h"
+
+namespace {
+
+constexpr size_t    live_count = 10000;
+constexpr size_t    churn_count = 10000000;
+constexpr int       container_size = 100000;
+constexpr int       refill_count = 50;
+constexpr int       thread_count = 4;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// An object of a typical size for a connection or request record.
+struct Record
+{
+    explicit Record(size_t id)
+      : _id{id}
+    {}
+
+    size_t  _id;
+    char    _payload[56]{};
+};
+
+// Keep a set of live objects, repeatedly freeing one at random and
+// creating another in its place.
+template<typename Create, typename Destroy>
+long long churn(Create create, Destroy destroy)
+{
+    std::vector<Record *>   live(live_count);
+    std::mt19937_64         engine{42};
+    size_t                  sum{0};
+    auto                    then{clock_type::now()};
+
+    for (size_t i = 0; i < live_count; ++i)
+        live[i] = create(i);
+
+    for (size_t i = 0; i < churn_count; ++i)
+    {
+        Record *&victim{live[engine() % live_count]};
+
+        sum += victim->_id;
+        destroy(victim);
+        victim = create(i);
+    }
+
+    for (Record *record : live)
+        destroy(record);
+
+    long long   ms{elapsed_ms(then)};
+
+    if (sum == 0)
+        std::cout << "  The records were lost!\n";
+
+    return ms;
+}
+
+// Fill a container and empty it again, many times over, with the default
+// allocator and with a PoolAllocator.
+template<typename Container, typename Fill, typename Empty>
+long long refill(Container &container, Fill fill, Empty empty)
+{
+    auto    then{clock_type::now()};
+
+    for (int r = 0; r < refill_count; ++r)
+    {
+        for (int i = 0; i < container_size; ++i)
+            fill(container, i);
+        while (!container.is_empty())
+            empty(container);
+    }
+
+    return elapsed_ms(then);
+}
+
+template<template<typename, typename> class List>
+void benchmark_list(const char *name)
+{
+    auto    fill = [](auto &list, int i) { list.append(i); };
+    auto    empty = [](auto &list) { list.remove(list.head()); };
+
+    List<int, std::allocator<int>>  plain;
+    long long                       plain_ms{refill(plain, fill, empty)};
+
+    SlotPool                        pool;
+    List<int, PoolAllocator<int>>   pooled{PoolAllocator<int>(pool)};
+    long long                       pooled_ms{refill(pooled, fill, empty)};
+
+    std::cout << "  " << std::left << std::setw(18) << name << std::right
+              << std::setw(6) << plain_ms << " ms" << std::setw(8) << pooled_ms << " ms\n";
+}
+
+void benchmark_stack()
+{
+    auto    fill = [](auto &stack, int i) { stack.push(i); };
+    auto    empty = [](auto &stack) { stack.pop(); };
+
+    Stack<int>                      plain;
+    long long                       plain_ms{refill(plain, fill, empty)};
+
+    SlotPool                        pool;
+    Stack<int, PoolAllocator<int>>  pooled{PoolAllocator<int>(pool)};
+    long long                       pooled_ms{refill(pooled, fill, empty)};
+
+    std::cout << "  " << std::left << std::setw(18) << "Stack" << std::right
+              << std::setw(6) << plain_ms << " ms" << std::setw(8) << pooled_ms << " ms\n";
+}
+
+// Run the churn on several threads at once, each thread allocating
+// through the given functions.
+template<typename Allocate, typename Free>
+long long threaded_churn(Allocate allocate, Free free)
+{
+    std::vector<std::thread>    threads;
+    auto                        then{clock_type::now()};
+
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&]
+                             {
+                                 churn([&](size_t id) { return ::new (allocate()) Record(id); },
+                                       [&](Record *record)
+                                       {
+                                           record->~Record();
+                                           free(record);
+                                       });
+                             });
+    }
+    for (auto &thread : threads)
+        thread.join();
+
+    return elapsed_ms(then);
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << churn_count << " replacements among " << live_count << " live objects\n";
+
+    long long   ms{churn([](size_t id) { return new Record(id); },
+                         [](Record *record) { delete record; })};
+
+    std::cout << "  new and delete:     " << std::setw(6) << ms << " ms\n";
+
+    ObjectPool<Record>  pool;
+
+    ms = churn([&](size_t id) { return pool.acquire(id); },
+               [&](Record *record) { pool.release(record); });
+    std::cout << "  ObjectPool:         " << std::setw(6) << ms << " ms, "
+              << pool.reserved() << " objects reserved\n";
+
+    std::cout << '\n' << refill_count << " fills and drains of " << container_size
+              << " nodes\n                   default     pooled\n";
+    benchmark_stack();
+    benchmark_list<SingleLinkedList>("SingleLinkedList");
+    benchmark_list<DoubleLinkedList>("DoubleLinkedList");
+
+    std::cout << '\n' << thread_count << " threads, each with the same replacements\n";
+
+    ms = threaded_churn([] { return ::operator new(sizeof(Record)); },
+                        [](void *memory) { ::operator delete(memory); });
+    std::cout << "  new and delete:                 " << std::setw(6) << ms << " ms\n";
+
+    ConcurrentSlotPool  locked(sizeof(Record), alignof(Record), 0);
+
+    ms = threaded_churn([&] { return locked.allocate(sizeof(Record), alignof(Record)); },
+                        [&](void *memory) { locked.deallocate(memory, sizeof(Record), alignof(Record)); });
+    std::cout << "  ConcurrentSlotPool, no caches:  " << std::setw(6) << ms << " ms\n";
+
+    ConcurrentSlotPool  cached(sizeof(Record), alignof(Record));
+
+    ms = threaded_churn([&] { return cached.allocate(sizeof(Record), alignof(Record)); },
+                        [&](void *memory) { cached.deallocate(memory, sizeof(Record), alignof(Record)); });
+    std::cout << "  ConcurrentSlotPool, caches:     " << std::setw(6) << ms << " ms\n";
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/// \file   arena.c
+/// \brief  Implementation of a monotonic arena in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <stdint.h>
+#include <stdlib.h> // for malloc/free
+
+#include "arena.h"
+
+// Alignment of every allocation, suitable for any of the basic types.
+#define ARENA_ALIGNMENT     16
+
+// Smallest block the arena will obtain.
+#define ARENA_MIN_BLOCK     256
+
+// Offset of the first allocation in a block, past the block header.
+#define ARENA_HEADER_SIZE   ((sizeof(arena_block) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+// Round a size up to a multiple of the alignment.
+static size_t align_size(size_t size)
+{
+    return (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+// Obtain a new block large enough for an allocation of the given size.
+static int add_block(arena *arena, size_t required)
+{
+    size_t size = arena->next_block_size;
+    arena_block *block;
+
+    while (size < required + ARENA_HEADER_SIZE)
+        size *= 2;
+
+    block = (arena_block *)malloc(size);
+    if (block == NULL)
+        return 0;
+
+    block->previous = arena->blocks;
+    block->size = size;
+    arena->blocks = block;
+    arena->current = (char *)block + ARENA_HEADER_SIZE;
+    arena->end = (char *)block + size;
+    arena->next_block_size = size * 2;
+
+    return 1;
+}
+
+/// \brief  Create a new, empty arena.
+/// \param initial_block_size   The size of the first block of memory to be
+///                             obtained. No memory is obtained until the
+///                             first allocation.
+/// \return A pointer to a new arena, or NULL if memory could not be allocated.
+arena *arena_create(size_t initial_block_size)
+{
+    arena *new_arena = (arena *)malloc(sizeof(arena));
+
+    if (new_arena != NULL)
+    {
+        new_arena->blocks = NULL;
+        new_arena->current = new_arena->end = NULL;
+        new_arena->next_block_size = initial_block_size < ARENA_MIN_BLOCK ? ARENA_MIN_BLOCK
+                                                                          : initial_block_size;
+        new_arena->bytes_used = 0;
+    }
+
+    return new_arena;
+}
+
+/// \brief  Delete an arena, freeing all of its memory.
+/// \param arena    A pointer to the arena to be deleted.
+void arena_delete(arena *arena)
+{
+    arena_block *block = arena->blocks;
+
+    while (block != NULL)
+    {
+        arena_block *previous = block->previous;
+
+        free(block);
+        block = previous;
+    }
+
+    free(arena);
+}
+
+/// \brief  Allocate memory from an arena.
+/// \param arena    A pointer to the arena.
+/// \param size     The number of bytes required.
+/// \return A pointer to memory aligned for any of the basic types, or NULL
+///         if a new block could not be obtained.
+/// \remark The memory cannot be freed individually; it is reclaimed by
+///         arena_reset or arena_delete.
+void *arena_alloc(arena *arena, size_t size)
+{
+    void *memory;
+
+    size = align_size(size);
+    if (arena->current == NULL || size > (size_t)(arena->end - arena->current))
+        if (!add_block(arena, size))
+            return NULL;
+
+    memory = arena->current;
+    arena->current += size;
+    arena->bytes_used += size;
+
+    return memory;
+}
+
+/// \brief  Allocate memory from an arena passed as an opaque pointer.
+/// \param arena    A pointer to the arena.
+/// \param size     The number of bytes required.
+/// \return A pointer to memory aligned for any of the basic types, or NULL
+///         if a new block could not be obtained.
+///
+/// This adapter matches the allocation callbacks of other modules, such as
+/// the list_allocate_fn taken by sll_create_node_from and
+/// dll_create_node_from, so that they can draw from an arena without
+/// depending on it.
+void *arena_allocate(void *arena, size_t size)
+{
+    return arena_alloc((struct arena *)arena, size);
+}
+
+/// \brief  Release every allocation made from an arena.
+/// \param arena    A pointer to the arena.
+/// \remark The most recently obtained block, which is also the largest, is
+///         kept for the allocations that follow; every other block is freed.
+void arena_reset(arena *arena)
+{
+    arena_block *kept = arena->blocks;
+    arena_block *block;
+
+    if (kept == NULL)
+        return;
+
+    block = kept->previous;
+    while (block != NULL)
+    {
+        arena_block *previous = block->previous;
+
+        free(block);
+        block = previous;
+    }
+
+    kept->previous = NULL;
+    arena->current = (char *)kept + ARENA_HEADER_SIZE;
+    arena->bytes_used = 0;
+}
+
+/// \brief  Return the number of bytes handed out by an arena since it was
+///         created or last reset.
+/// \param arena    A pointer to the arena.
+size_t arena_bytes_used(const arena *arena)
+{
+    return arena->bytes_used;
+}
+
+/// \brief  Return the number of bytes an arena has obtained in blocks.
+/// \param arena    A pointer to the arena.
+size_t arena_bytes_reserved(const arena *arena)
+{
+    const arena_block *block;
+    size_t total = 0;
+
+    for (block = arena->blocks; block != NULL; block = block->previous)
+        total += block->size;
+
+    return total;
+}
@@ -0,0 +1,43 @@
+/// \file   arena.h
+/// \brief  Structure definition and function declarations for a monotonic
+///         arena in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_ARENA_H
+#define INC_ARENA_H
+
+#include <stddef.h>
+
+/// \brief  A block of memory obtained by an arena.
+typedef struct arena_block
+{
+    struct arena_block *previous;   ///< The block obtained before this one
+    size_t size;                    ///< Size of the block, including this header
+} arena_block;
+
+/// \brief  A region of memory from which objects are allocated by bumping a
+///         pointer, and which is released all at once.
+///
+/// Memory is obtained with malloc in blocks, each twice the size of the
+/// previous one. Individual allocations are never freed; arena_reset
+/// releases all of them with a cost that depends only on the number of
+/// blocks.
+typedef struct arena
+{
+    arena_block *blocks;    ///< Most recently obtained block
+    char *current;          ///< Next free byte in the current block
+    char *end;              ///< End of the current block
+    size_t next_block_size; ///< Size of the next block to be obtained
+    size_t bytes_used;      ///< Bytes handed out since the last reset
+} arena;
+
+arena *arena_create(size_t initial_block_size);
+void arena_delete(arena *arena);
+void *arena_alloc(arena *arena, size_t size);
+void *arena_allocate(void *arena, size_t size);
+void arena_reset(arena *arena);
+size_t arena_bytes_used(const arena *arena);
+size_t arena_bytes_reserved(const arena *arena);
+
+#endif  // INC_ARENA_H
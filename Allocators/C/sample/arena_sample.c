@@ -0,0 +1,80 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../arena.h"
+#include "../../../LinkedList/C/single_linked_list.h"
+#include "../../../LinkedList/C/double_linked_list.h"
+
+// Helper function to compute the processor time used since a starting point.
+long elapsed_ms(clock_t then)
+{
+    return (long)((clock() - then) * 1000 / CLOCKS_PER_SEC);
+}
+
+// Compare the time taken to tear down lists built with malloc and with an
+// arena, for a given number of nodes.
+void benchmark_teardown(arena *arena, int count)
+{
+    sll_node *single_head = NULL;
+    sll_node *single_tail = NULL;
+    dll_node *double_head = NULL;
+    dll_node *double_tail = NULL;
+    clock_t then;
+    int i;
+
+    printf("Teardown of %d nodes\n", count);
+
+    // Nodes are linked directly at the tail rather than with the append
+    // functions, which search for the tail on every call.
+    for (i = 0; i < count; ++i)
+        single_tail = single_tail == NULL ? sll_prepend_node(&single_head, sll_create_node(i))
+                                          : sll_insert_node_after(single_tail, sll_create_node(i));
+    then = clock();
+    sll_erase(&single_head);
+    printf("  singly-linked list, sll_erase:   %ld ms\n", elapsed_ms(then));
+
+    for (i = 0; i < count; ++i)
+        double_tail = double_tail == NULL ? dll_prepend_node(&double_head, dll_create_node(i))
+                                          : dll_insert_node_after(double_tail, dll_create_node(i));
+    then = clock();
+    dll_erase(&double_head);
+    printf("  doubly-linked list, dll_erase:   %ld ms\n", elapsed_ms(then));
+
+    single_tail = NULL;
+    for (i = 0; i < count; ++i)
+        single_tail = single_tail == NULL ? sll_prepend_node(&single_head, sll_create_node_from(arena_allocate, arena, i))
+                                          : sll_insert_node_after(single_tail, sll_create_node_from(arena_allocate, arena, i));
+    double_tail = NULL;
+    for (i = 0; i < count; ++i)
+        double_tail = double_tail == NULL ? dll_prepend_node(&double_head, dll_create_node_from(arena_allocate, arena, i))
+                                          : dll_insert_node_after(double_tail, dll_create_node_from(arena_allocate, arena, i));
+    printf("  both lists used %zu bytes of arena\n", arena_bytes_used(arena));
+
+    then = clock();
+    arena_reset(arena);
+    single_head = NULL;
+    double_head = NULL;
+    printf("  both lists, arena_reset:         %ld ms\n", elapsed_ms(then));
+}
+
+int main(void)
+{
+    arena *arena = arena_create(4096);
+
+    if (arena == NULL)
+    {
+        printf("Failed to create an arena.\n");
+        return EXIT_FAILURE;
+    }
+
+    benchmark_teardown(arena, 100000);
+    benchmark_teardown(arena, 1000000);
+    benchmark_teardown(arena, 10000000);
+
+    arena_delete(arena);
+
+    return 0;
+}
@@ -0,0 +1,40 @@
+/// \file   BulkRelease.h
+/// \brief  Trait marking the allocators whose memory is reclaimed all at once
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_BULK_RELEASE
+#define INC_BULK_RELEASE
+
+#include <type_traits>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+
+/// \brief  Whether memory obtained from an allocator is reclaimed by its
+///         source all at once, so that a container using it may abandon its
+///         nodes with \c release instead of freeing them one by one.
+///
+/// The containers' \c release member functions do not compile for an
+/// allocator without this property, such as \c std::allocator, with which
+/// abandoned nodes would simply leak. An allocator drawing from an arena or
+/// a pool is marked by specializing the trait alongside it.
+///
+/// \tparam Allocator   The allocator type, for any element type.
+template<typename Allocator>
+struct releases_in_bulk : std::false_type
+{
+};
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+/// \brief  A polymorphic allocator's memory resource is chosen at run time,
+///         and is accepted on the understanding that it is one that frees
+///         its memory in bulk, such as \c std::pmr::monotonic_buffer_resource
+///         or a pool resource, rather than the default heap resource.
+template<typename T>
+struct releases_in_bulk<std::pmr::polymorphic_allocator<T>> : std::true_type
+{
+};
+#endif
+
+#endif // INC_BULK_RELEASE
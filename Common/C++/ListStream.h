@@ -0,0 +1,250 @@
+/// \file   ListStream.h
+/// \brief  Streaming binary serialization of linked lists and stacks
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_STREAM
+#define INC_LIST_STREAM
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <type_traits>
+
+/// \brief  Helpers used by the \c serialize and \c deserialize member
+///         functions of SingleLinkedList, DoubleLinkedList and Stack.
+///
+/// A serialized list is a header followed by the elements in list order,
+/// grouped into length-prefixed chunks:
+///
+///     uint32  element size, or zero if the elements are custom-encoded
+///     uint64  total number of elements
+///     repeated until all elements have been written:
+///         uint32  number of elements in this chunk
+///         the elements of the chunk
+///
+/// Elements of a trivially copyable type are stored as their raw bytes,
+/// copied a chunk at a time through a fixed-size buffer, so a chunk is
+/// produced with a single write. Other types are written one element at a
+/// time by a caller-supplied encoder. Integers are stored in the native
+/// byte order of the machine.
+///
+/// A \c Writer is any object with a \c write(const char *, std::streamsize)
+/// member and a conversion to \c bool reporting its state, such as
+/// \c std::ostream. A \c Reader likewise provides
+/// \c read(char *, std::streamsize), as \c std::istream does.
+namespace list_stream
+{
+
+/// \brief  Size in bytes of the buffer through which chunks are streamed.
+constexpr std::size_t   buffer_size{4096};
+
+/// \brief  Number of elements in each chunk of custom-encoded elements.
+constexpr std::uint32_t encoded_chunk{1024};
+
+/// \brief  Return the number of elements of type \c T in a chunk.
+template<typename T>
+constexpr std::size_t chunk_elements() noexcept
+{
+    return sizeof(T) >= buffer_size ? 1 : buffer_size / sizeof(T);
+}
+
+/// \brief  Write raw bytes, returning the writer's state.
+template<typename Writer>
+bool write_bytes(Writer &writer, const void *data, std::size_t length)
+{
+    writer.write(static_cast<const char *>(data), static_cast<std::streamsize>(length));
+    return static_cast<bool>(writer);
+}
+
+/// \brief  Read raw bytes, returning the reader's state.
+template<typename Reader>
+bool read_bytes(Reader &reader, void *data, std::size_t length)
+{
+    reader.read(static_cast<char *>(data), static_cast<std::streamsize>(length));
+    return static_cast<bool>(reader);
+}
+
+/// \brief  Write the header of a serialized list.
+template<typename Writer>
+bool write_header(Writer &writer, std::uint32_t element_size, std::uint64_t count)
+{
+    return write_bytes(writer, &element_size, sizeof(element_size))
+        && write_bytes(writer, &count, sizeof(count));
+}
+
+/// \brief  Read the header of a serialized list.
+///
+/// \return \c false if the header could not be read or the element size
+///         does not match \p element_size.
+template<typename Reader>
+bool read_header(Reader &reader, std::uint32_t element_size, std::uint64_t &count)
+{
+    std::uint32_t   stored_size;
+
+    return read_bytes(reader, &stored_size, sizeof(stored_size))
+        && stored_size == element_size
+        && read_bytes(reader, &count, sizeof(count));
+}
+
+/// \brief  Write the elements of a list of trivially copyable data.
+///
+/// \param writer   The destination of the serialized list.
+/// \param node     Pointer to the first node to be written.
+/// \param count    Number of nodes to be written.
+template<typename T, typename Writer, typename Node>
+bool write(Writer &writer, Node *node, std::uint64_t count)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Serializing a type that is not trivially copyable requires an encoder");
+
+    constexpr std::size_t   chunk{chunk_elements<T>()};
+    unsigned char           buffer[chunk * sizeof(T)];
+
+    if (!write_header(writer, sizeof(T), count))
+        return false;
+
+    while (count > 0)
+    {
+        std::uint32_t   used{0};
+
+        for (; used < chunk && used < count; ++used, node = node->next())
+            std::memcpy(buffer + used * sizeof(T), &node->data(), sizeof(T));
+
+        if (!write_bytes(writer, &used, sizeof(used))
+            || !write_bytes(writer, buffer, used * sizeof(T)))
+            return false;
+
+        count -= used;
+    }
+
+    return true;
+}
+
+/// \brief  Write the elements of a list, encoding each with a caller-supplied
+///         function.
+///
+/// \param writer   The destination of the serialized list.
+/// \param node     Pointer to the first node to be written.
+/// \param count    Number of nodes to be written.
+/// \param encode   Function called as \c encode(writer, data) for each
+///                 element, returning \c false on failure.
+template<typename Writer, typename Node, typename Encoder>
+bool write(Writer &writer, Node *node, std::uint64_t count, Encoder encode)
+{
+    if (!write_header(writer, 0, count))
+        return false;
+
+    while (count > 0)
+    {
+        std::uint32_t   used{static_cast<std::uint32_t>(count < encoded_chunk ? count : encoded_chunk)};
+
+        if (!write_bytes(writer, &used, sizeof(used)))
+            return false;
+
+        for (std::uint32_t i{0}; i < used; ++i, node = node->next())
+            if (!encode(writer, node->data()))
+                return false;
+
+        count -= used;
+    }
+
+    return true;
+}
+
+/// \brief  Read the elements of a serialized list of trivially copyable data.
+///
+/// \param reader   The source of the serialized list.
+/// \param sink     Function called with each element read, in list order.
+///
+/// \return \c true if a complete list was read, \c false otherwise.
+template<typename T, typename Reader, typename Sink>
+bool read(Reader &reader, Sink sink)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Deserializing a type that is not trivially copyable requires a decoder");
+
+    constexpr std::size_t   chunk{chunk_elements<T>()};
+    unsigned char           buffer[chunk * sizeof(T)];
+    std::uint64_t           count;
+
+    if (!read_header(reader, sizeof(T), count))
+        return false;
+
+    while (count > 0)
+    {
+        std::uint32_t   length;
+
+        if (!read_bytes(reader, &length, sizeof(length)) || length == 0 || length > count)
+            return false;
+
+        count -= length;
+
+        // The chunk may have been written with a larger buffer than ours,
+        // so it is read in pieces no larger than our buffer.
+        while (length > 0)
+        {
+            std::uint32_t   piece{length < chunk ? length : static_cast<std::uint32_t>(chunk)};
+
+            if (!read_bytes(reader, buffer, piece * sizeof(T)))
+                return false;
+
+            for (std::uint32_t i{0}; i < piece; ++i)
+            {
+                T   value;
+
+                std::memcpy(static_cast<void *>(&value), buffer + i * sizeof(T), sizeof(T));
+                sink(value);
+            }
+
+            length -= piece;
+        }
+    }
+
+    return true;
+}
+
+/// \brief  Read the elements of a serialized list, decoding each with a
+///         caller-supplied function.
+///
+/// \param reader   The source of the serialized list.
+/// \param decode   Function called as \c decode(reader, data) to read each
+///                 element into a default-constructed \c T, returning
+///                 \c false on failure.
+/// \param sink     Function called with each element read, in list order.
+///
+/// \return \c true if a complete list was read, \c false otherwise.
+template<typename T, typename Reader, typename Decoder, typename Sink>
+bool read(Reader &reader, Decoder decode, Sink sink)
+{
+    std::uint64_t   count;
+
+    if (!read_header(reader, 0, count))
+        return false;
+
+    while (count > 0)
+    {
+        std::uint32_t   length;
+
+        if (!read_bytes(reader, &length, sizeof(length)) || length == 0 || length > count)
+            return false;
+
+        count -= length;
+
+        for (std::uint32_t i{0}; i < length; ++i)
+        {
+            T   value{};
+
+            if (!decode(reader, value))
+                return false;
+            sink(value);
+        }
+    }
+
+    return true;
+}
+
+} // namespace list_stream
+
+#endif // INC_LIST_STREAM
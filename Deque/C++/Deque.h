@@ -0,0 +1,507 @@
+/// \file   Deque.h
+/// \brief  Implementation of a segmented, array-backed double-ended queue in C++.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_DEQUE
+#define INC_DEQUE
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// \brief  A double-ended queue whose items are stored in fixed-size
+///         contiguous blocks.
+///
+/// The blocks are reached through a map, a circular array of block
+/// pointers. Items are pushed and popped at either end in constant time,
+/// and any item can be reached by position in constant time. Memory is
+/// obtained a block at a time rather than an item at a time, and one
+/// emptied block is kept to be reused, so a deque whose size hovers around
+/// a block boundary does not allocate repeatedly.
+///
+/// Items never move once they have been pushed: growing the map copies
+/// only the block pointers. Pointers and references to items therefore
+/// remain valid while items are pushed or popped at either end, until the
+/// item they refer to is itself popped.
+///
+/// \tparam T           The type of the items held by the deque.
+/// \tparam Allocator   The allocator from which the blocks and the map are
+///                     obtained. It is rebound to the types required.
+template <typename T, typename Allocator = std::allocator<T>>
+class Deque
+{
+public:
+
+    /// \brief  The type of the allocator used by the deque.
+    using allocator_type = Allocator;
+
+    /// \brief  The number of items held by each block.
+    ///
+    /// Small items are packed into blocks of about 4 KB; large items are
+    /// stored sixteen to a block.
+    static constexpr size_t block_size{sizeof(T) < 256 ? 4096 / sizeof(T) : 16};
+
+    /// \brief  Default-construct an empty Deque.
+    Deque() = default;
+
+    /// \brief  Construct an empty Deque whose blocks are obtained from the
+    ///         given allocator.
+    explicit Deque(const Allocator &allocator)
+      : _allocator(allocator),
+        _map_allocator(allocator)
+    {
+    }
+
+    /// \brief  Copy-construction is not allowed.
+    Deque(const Deque &) = delete;
+
+    /// \brief  Copy-assignment is not allowed.
+    Deque &operator=(const Deque &) = delete;
+
+    /// \brief  Destroy the Deque, destroying its items and freeing its blocks.
+    ~Deque()
+    {
+        clear();
+        free_spare();
+        if (_map)
+            map_traits::deallocate(_map_allocator, _map, _map_capacity);
+    }
+
+    /// \brief  Add an item at the back of the deque.
+    ///
+    /// \param value    The item to be added.
+    void push_back(const T &value)
+    {
+        emplace_back(value);
+    }
+
+    /// \brief  Add an item at the back of the deque.
+    ///
+    /// \param value    The item to be moved into the deque.
+    void push_back(T &&value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    /// \brief  Construct an item in place at the back of the deque.
+    ///
+    /// \param args     Arguments passed to the item's constructor.
+    ///
+    /// \return A reference to the new item.
+    ///
+    /// If the item's constructor throws an exception the deque is unchanged.
+    template<typename... Args>
+    T &emplace_back(Args &&...args)
+    {
+        const size_t    end{_start + _size};
+
+        if (end < _block_count * block_size)
+        {
+            T  *item{block(end / block_size) + end % block_size};
+
+            block_traits::construct(_allocator, item, std::forward<Args>(args)...);
+            ++_size;
+            return *item;
+        }
+
+        // The last block is full, or there are none: the item starts a new
+        // block, which is linked in only once the item has been constructed.
+        reserve_map_slot();
+
+        T  *new_block{obtain_block()};
+
+        construct_or_keep(new_block, new_block, std::forward<Args>(args)...);
+        _map[(_first_block + _block_count) & (_map_capacity - 1)] = new_block;
+        ++_block_count;
+        ++_size;
+        return *new_block;
+    }
+
+    /// \brief  Add an item at the front of the deque.
+    ///
+    /// \param value    The item to be added.
+    void push_front(const T &value)
+    {
+        emplace_front(value);
+    }
+
+    /// \brief  Add an item at the front of the deque.
+    ///
+    /// \param value    The item to be moved into the deque.
+    void push_front(T &&value)
+    {
+        emplace_front(std::move(value));
+    }
+
+    /// \brief  Construct an item in place at the front of the deque.
+    ///
+    /// \param args     Arguments passed to the item's constructor.
+    ///
+    /// \return A reference to the new item.
+    ///
+    /// If the item's constructor throws an exception the deque is unchanged.
+    template<typename... Args>
+    T &emplace_front(Args &&...args)
+    {
+        if (_start > 0)
+        {
+            T  *item{_map[_first_block] + _start - 1};
+
+            block_traits::construct(_allocator, item, std::forward<Args>(args)...);
+            --_start;
+            ++_size;
+            return *item;
+        }
+
+        // The first block is full at its front, or there are none: the item
+        // goes at the end of a new block placed before it.
+        reserve_map_slot();
+
+        T  *new_block{obtain_block()};
+        T  *item{new_block + block_size - 1};
+
+        construct_or_keep(new_block, item, std::forward<Args>(args)...);
+        _first_block = (_first_block - 1) & (_map_capacity - 1);
+        _map[_first_block] = new_block;
+        ++_block_count;
+        _start = block_size - 1;
+        ++_size;
+        return *item;
+    }
+
+    /// \brief  Remove the item at the back of the deque.
+    ///
+    /// Calling \c pop_back on an empty deque is an error.
+    void pop_back()
+    {
+        assert(!is_empty());
+
+        block_traits::destroy(_allocator, &back());
+        --_size;
+
+        if (_size == 0)
+            release_blocks();
+        else if ((_start + _size) % block_size == 0)
+            retire_block(--_block_count);
+    }
+
+    /// \brief  Remove the item at the front of the deque.
+    ///
+    /// Calling \c pop_front on an empty deque is an error.
+    void pop_front()
+    {
+        assert(!is_empty());
+
+        block_traits::destroy(_allocator, &front());
+        --_size;
+
+        if (_size == 0)
+        {
+            release_blocks();
+        }
+        else if (++_start == block_size)
+        {
+            retire_block(0);
+            _first_block = (_first_block + 1) & (_map_capacity - 1);
+            --_block_count;
+            _start = 0;
+        }
+    }
+
+    /// \brief  Access the item at the front of the deque.
+    ///
+    /// Calling \c front on an empty deque is an error.
+    T &front()
+    {
+        assert(!is_empty());
+        return _map[_first_block][_start];
+    }
+
+    /// \brief  Access the item at the front of the deque.
+    ///
+    /// Calling \c front on an empty deque is an error.
+    const T &front() const
+    {
+        assert(!is_empty());
+        return _map[_first_block][_start];
+    }
+
+    /// \brief  Access the item at the back of the deque.
+    ///
+    /// Calling \c back on an empty deque is an error.
+    T &back()
+    {
+        assert(!is_empty());
+        return item_at(_size - 1);
+    }
+
+    /// \brief  Access the item at the back of the deque.
+    ///
+    /// Calling \c back on an empty deque is an error.
+    const T &back() const
+    {
+        assert(!is_empty());
+        return item_at(_size - 1);
+    }
+
+    /// \brief  Access an item by its position from the front of the deque.
+    ///
+    /// \param index    The position of the item, zero being the front.
+    ///
+    /// Calling \c operator[] with an index not less than \c size is an error.
+    T &operator[](size_t index)
+    {
+        assert(index < _size);
+        return item_at(index);
+    }
+
+    /// \brief  Access an item by its position from the front of the deque.
+    ///
+    /// \param index    The position of the item, zero being the front.
+    ///
+    /// Calling \c operator[] with an index not less than \c size is an error.
+    const T &operator[](size_t index) const
+    {
+        assert(index < _size);
+        return item_at(index);
+    }
+
+    /// \brief  Access an item by its position from the front of the deque,
+    ///         checking that the position is valid.
+    ///
+    /// \param index    The position of the item, zero being the front.
+    ///
+    /// \exception std::out_of_range    \p index is not less than \c size.
+    T &at(size_t index)
+    {
+        if (index >= _size)
+            throw std::out_of_range("Deque index out of range");
+        return item_at(index);
+    }
+
+    /// \brief  Access an item by its position from the front of the deque,
+    ///         checking that the position is valid.
+    ///
+    /// \param index    The position of the item, zero being the front.
+    ///
+    /// \exception std::out_of_range    \p index is not less than \c size.
+    const T &at(size_t index) const
+    {
+        if (index >= _size)
+            throw std::out_of_range("Deque index out of range");
+        return item_at(index);
+    }
+
+    /// \brief  Visit every item from the front of the deque to the back.
+    ///
+    /// \param visit    Function called with a reference to each item.
+    ///
+    /// Each block is visited as a contiguous run of items, without the
+    /// position arithmetic of \c operator[].
+    template<typename Visitor>
+    void for_each(Visitor visit)
+    {
+        visit_blocks(*this, visit);
+    }
+
+    /// \brief  Visit every item from the front of the deque to the back.
+    ///
+    /// \param visit    Function called with a const reference to each item.
+    template<typename Visitor>
+    void for_each(Visitor visit) const
+    {
+        visit_blocks(*this, visit);
+    }
+
+    /// \brief  Determine if the deque is empty.
+    ///
+    /// \return \c true if the deque is empty, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /// \brief  Get the number of items currently in the deque.
+    size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    /// \brief  Destroy every item, leaving the deque empty.
+    ///
+    /// One block is kept for reuse; the map is kept at its current size.
+    void clear() noexcept
+    {
+        if (_size == 0)
+            return;
+
+        if (!std::is_trivially_destructible<T>::value)
+            visit_blocks(*this, [this](T &item) { block_traits::destroy(_allocator, &item); });
+
+        _size = 0;
+        release_blocks();
+    }
+
+    /// \brief  Return a copy of the deque's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+private:
+    using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using block_traits = std::allocator_traits<block_allocator>;
+    using map_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T *>;
+    using map_traits = std::allocator_traits<map_allocator>;
+
+    static constexpr size_t initial_map_capacity{8};
+
+    // Return the block at a position counted from the first block.
+    T *block(size_t index) const noexcept
+    {
+        return _map[(_first_block + index) & (_map_capacity - 1)];
+    }
+
+    // Return the item at a position counted from the front.
+    T &item_at(size_t index) const noexcept
+    {
+        const size_t    offset{_start + index};
+
+        return block(offset / block_size)[offset % block_size];
+    }
+
+    // Call a function on every item, one block at a time.
+    template<typename Self, typename Visitor>
+    static void visit_blocks(Self &self, Visitor &&visit)
+    {
+        using item_type = typename std::conditional<std::is_const<Self>::value, const T, T>::type;
+
+        size_t  remaining{self._size};
+        size_t  offset{self._start};
+
+        for (size_t b = 0; remaining > 0; ++b)
+        {
+            item_type  *items{self.block(b) + offset};
+            size_t      count{block_size - offset < remaining ? block_size - offset : remaining};
+
+            for (size_t i = 0; i < count; ++i)
+                visit(items[i]);
+
+            remaining -= count;
+            offset = 0;
+        }
+    }
+
+    // Construct an item in a block that is not yet linked into the map. If
+    // construction fails, the block is kept as the spare.
+    template<typename... Args>
+    void construct_or_keep(T *new_block, T *item, Args &&...args)
+    {
+        try
+        {
+            block_traits::construct(_allocator, item, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            return_block(new_block);
+            throw;
+        }
+    }
+
+    // Make sure the map has a free slot for another block. When the map is
+    // full it is replaced by one twice the size, with the blocks copied to
+    // the start of the new map in order. The blocks themselves do not move.
+    void reserve_map_slot()
+    {
+        if (_block_count < _map_capacity)
+            return;
+
+        const size_t    new_capacity{_map_capacity ? _map_capacity * 2 : initial_map_capacity};
+        T             **new_map{map_traits::allocate(_map_allocator, new_capacity)};
+
+        for (size_t b = 0; b < _block_count; ++b)
+            new_map[b] = block(b);
+
+        if (_map)
+            map_traits::deallocate(_map_allocator, _map, _map_capacity);
+
+        _map = new_map;
+        _map_capacity = new_capacity;
+        _first_block = 0;
+    }
+
+    // Obtain an uninitialized block, reusing the spare if there is one.
+    T *obtain_block()
+    {
+        if (_spare)
+            return std::exchange(_spare, nullptr);
+
+        return block_traits::allocate(_allocator, block_size);
+    }
+
+    // Keep an emptied block as the spare, or free it if there already is one.
+    void return_block(T *old_block) noexcept
+    {
+        if (_spare)
+            block_traits::deallocate(_allocator, old_block, block_size);
+        else
+            _spare = old_block;
+    }
+
+    // Return the block at a position counted from the first block. The
+    // caller adjusts the count and the first block.
+    void retire_block(size_t index) noexcept
+    {
+        return_block(block(index));
+    }
+
+    // Return every block once the deque is empty, and start the next push
+    // afresh.
+    void release_blocks() noexcept
+    {
+        for (size_t b = 0; b < _block_count; ++b)
+            return_block(block(b));
+
+        _block_count = 0;
+        _first_block = 0;
+        _start = 0;
+    }
+
+    // Free the spare block, if there is one.
+    void free_spare() noexcept
+    {
+        if (_spare)
+            block_traits::deallocate(_allocator, std::exchange(_spare, nullptr), block_size);
+    }
+
+    // Instance data
+    T             **_map{nullptr};          ///< Circular array of block pointers
+    size_t          _map_capacity{0};       ///< Number of slots in the map; a power of two
+    size_t          _first_block{0};        ///< Map slot of the block holding the front item
+    size_t          _block_count{0};        ///< Number of blocks in use
+    size_t          _start{0};              ///< Position of the front item in the first block
+    size_t          _size{0};               ///< Number of items in the deque
+    T              *_spare{nullptr};        ///< An emptied block kept for reuse
+    block_allocator _allocator;             ///< Allocator from which blocks are obtained
+    map_allocator   _map_allocator;         ///< Allocator from which the map is obtained
+};
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  A Deque whose blocks are obtained from a \c std::pmr::memory_resource.
+template<typename T>
+using Deque = ::Deque<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
+#endif  // INC_DEQUE
@@ -0,0 +1,275 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../Deque.h"
+#include "../../../LinkedList/C++/DoubleLinkedList.h"
+
+namespace {
+
+constexpr size_t    element_count = 1000000;
+constexpr int       pass_count = 10;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Apply random pushes and pops at both ends to a Deque and to a std::deque,
+// and check that they agree throughout. Strings are used so that items are
+// constructed and destroyed properly, and a pointer to one item is kept to
+// check that it does not move while the deque changes around it.
+bool check_against_std_deque()
+{
+    Deque<std::string>      deque;
+    std::deque<std::string> reference;
+    std::mt19937_64         engine{2019};
+
+    deque.push_back("anchor");
+    reference.push_back("anchor");
+
+    const std::string      *anchor{&deque.front()};
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        // Grow for a while, then shrink, so the deque crosses many block
+        // boundaries in both directions. The anchor is never popped.
+        bool        growing{(i / 20000) % 2 == 0};
+        unsigned    choice{unsigned(engine() % 4)};
+        std::string value{std::to_string(i)};
+
+        if (growing ? choice != 3 : choice == 3 || reference.size() < 2)
+        {
+            if (engine() % 2)
+            {
+                deque.push_back(value);
+                reference.push_back(value);
+            }
+            else
+            {
+                deque.push_front(value);
+                reference.push_front(value);
+            }
+        }
+        else if (reference.back() != "anchor" && engine() % 2)
+        {
+            deque.pop_back();
+            reference.pop_back();
+        }
+        else if (reference.front() != "anchor")
+        {
+            deque.pop_front();
+            reference.pop_front();
+        }
+
+        if (deque.size() != reference.size() || deque.front() != reference.front()
+            || deque.back() != reference.back())
+            return false;
+
+        size_t  index{size_t(engine() % reference.size())};
+
+        if (deque[index] != reference[index])
+            return false;
+    }
+
+    size_t  index{0};
+    bool    same{true};
+
+    deque.for_each([&](const std::string &item) { same = same && item == reference[index++]; });
+
+    for (size_t i = 0; i < reference.size(); ++i)
+    {
+        if (deque.at(i) != reference[i])
+            return false;
+    }
+
+    // Items pushed in front of the anchor have changed its position, so
+    // look for it at every position.
+    bool    anchored{false};
+
+    for (size_t i = 0; i < deque.size(); ++i)
+        anchored = anchored || (&deque[i] == anchor && *anchor == "anchor");
+
+    return same && index == reference.size() && anchored;
+}
+
+// A queue with a steady length: each pass fills it, then pushes a new item
+// at the back for every item it takes from the front.
+template<typename Push, typename Pop>
+long long run_queue(Push push, Pop pop)
+{
+    long long   sum{0};
+
+    for (int p = 0; p < pass_count; ++p)
+    {
+        for (size_t i = 0; i < element_count / 10; ++i)
+            push(int(i));
+        for (size_t i = 0; i < element_count; ++i)
+        {
+            sum += pop();
+            push(int(i));
+        }
+        for (size_t i = 0; i < element_count / 10; ++i)
+            sum += pop();
+    }
+
+    return sum;
+}
+
+// A work list used from both ends: items are added at either end and taken
+// mostly from the back, as an owner does, sometimes from the front, as a
+// thief does.
+template<typename PushBack, typename PushFront, typename PopBack, typename PopFront, typename Size>
+long long run_both_ends(PushBack push_back, PushFront push_front, PopBack pop_back,
+                        PopFront pop_front, Size size)
+{
+    std::mt19937_64 engine{42};
+    long long       sum{0};
+
+    for (int p = 0; p < pass_count; ++p)
+    {
+        for (size_t i = 0; i < element_count; ++i)
+        {
+            unsigned    choice{unsigned(engine() % 8)};
+
+            if ((choice < 4 || size() == 0) && choice % 2)
+                push_back(int(i));
+            else if (choice < 4 || size() == 0)
+                push_front(int(i));
+            else if (choice < 7)
+                sum += pop_back();
+            else
+                sum += pop_front();
+        }
+        while (size() > 0)
+            sum += pop_back();
+    }
+
+    return sum;
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << "Deque agrees with std::deque: "
+              << (check_against_std_deque() ? "yes" : "NO") << "\n\n";
+
+    DoubleLinkedList<int>   list;
+    Deque<int>              deque;
+
+    std::cout << pass_count << " passes of " << element_count << " queue operations\n";
+
+    auto        then{clock_type::now()};
+    long long   sum{run_queue([&](int v) { list.append(v); },
+                              [&]
+                              {
+                                  int value{list.head()->data()};
+
+                                  list.remove(list.head());
+                                  return value;
+                              })};
+
+    std::cout << "  DoubleLinkedList:   " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    sum -= run_queue([&](int v) { deque.push_back(v); },
+                     [&]
+                     {
+                         int value{deque.front()};
+
+                         deque.pop_front();
+                         return value;
+                     });
+    std::cout << "  Deque:              " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    std::cout << pass_count << " passes of " << element_count << " operations at both ends\n";
+
+    then = clock_type::now();
+    sum += run_both_ends([&](int v) { list.append(v); },
+                         [&](int v) { list.prepend(v); },
+                         [&]
+                         {
+                             int value{list.tail()->data()};
+
+                             list.remove(list.tail());
+                             return value;
+                         },
+                         [&]
+                         {
+                             int value{list.head()->data()};
+
+                             list.remove(list.head());
+                             return value;
+                         },
+                         [&] { return list.size(); });
+    std::cout << "  DoubleLinkedList:   " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    sum -= run_both_ends([&](int v) { deque.push_back(v); },
+                         [&](int v) { deque.push_front(v); },
+                         [&]
+                         {
+                             int value{deque.back()};
+
+                             deque.pop_back();
+                             return value;
+                         },
+                         [&]
+                         {
+                             int value{deque.front()};
+
+                             deque.pop_front();
+                             return value;
+                         },
+                         [&] { return deque.size(); });
+    std::cout << "  Deque:              " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    if (sum != 0)
+        std::cout << "  The results differ!\n";
+
+    // Sum a long deque by position and by walking the list: the list has
+    // no other way to reach its items in order.
+    for (size_t i = 0; i < element_count; ++i)
+    {
+        list.append(int(i));
+        deque.push_back(int(i));
+    }
+
+    std::cout << pass_count << " traversals of " << element_count << " items\n";
+
+    then = clock_type::now();
+    for (int p = 0; p < pass_count; ++p)
+    {
+        for (auto *node = list.head(); node != nullptr; node = node->next())
+            sum += node->data();
+    }
+    std::cout << "  DoubleLinkedList:   " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    for (int p = 0; p < pass_count; ++p)
+        deque.for_each([&](int value) { sum -= value; });
+    std::cout << "  Deque for_each:     " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    for (int p = 0; p < pass_count; ++p)
+    {
+        for (size_t i = 0; i < deque.size(); ++i)
+            sum += deque[i];
+    }
+    std::cout << "  Deque operator[]:   " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    if (sum != (long long)(element_count * (element_count - 1) / 2) * pass_count)
+        std::cout << "  The sums differ!\n";
+
+    return 0;
+}
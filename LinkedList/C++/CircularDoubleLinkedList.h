@@ -0,0 +1,386 @@
+/// \file   CircularDoubleLinkedList.h
+/// \brief  A circular doubly-linked list with a sentinel node
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_CIRCULAR_DOUBLE_LINKED_LIST
+#define INC_CIRCULAR_DOUBLE_LINKED_LIST
+
+#include <memory>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+#include <type_traits>
+
+#include "BulkRelease.h"
+#include "ListStats.h"
+
+/// \brief  A doubly-linked list whose ends are joined through a sentinel
+///         node, so that inserting and removing never test for the ends.
+///
+/// \tparam T           The type of the elements held by the list.
+/// \tparam Allocator   The allocator from which the list's nodes are
+///                     obtained. It is rebound to the node type.
+///
+/// The sentinel holds no data. It follows the last node and precedes the
+/// first, and an empty list is a sentinel linked to itself. Every node
+/// therefore has a real neighbour on each side. Insertion and removal are
+/// the same four pointer assignments wherever the node is, without the
+/// branches on the head, the tail and null neighbours that DoubleLinkedList
+/// needs.
+///
+/// The interface follows DoubleLinkedList, except that a traversal ends at
+/// \c end(), the sentinel, rather than at \c nullptr:
+///
+///     for (auto *node = list.head(); node != list.end(); node = node->next())
+template<typename T, typename Allocator = std::allocator<T>>
+class CircularDoubleLinkedList
+{
+public:
+    /// \brief  The linked list node structure.
+    ///
+    /// This class is the core of the linked list, holding the list element's
+    /// data and the pointers to the next and previous node in the list.
+    /// The data is held in a union so that the sentinel, which has none,
+    /// can be a node like any other.
+    class node_t
+    {
+    private:
+        union
+        {
+            T   _data;              ///< Data contained in the node
+        };
+        node_t *_next;              ///< Pointer to the next node
+        node_t *_prev;              ///< Pointer to the previous node
+
+        // Construct a sentinel, linked to itself.
+        node_t() noexcept
+          : _next{this},
+            _prev{this}
+        {}
+
+    public:
+        explicit node_t(const T &data)
+          : _data{data},
+            _next{nullptr},
+            _prev{nullptr}
+        {}
+
+        // The list destroys the data of a node before destroying the node.
+        ~node_t()
+        {}
+
+        node_t(const node_t &) = delete;
+        node_t & operator=(const node_t &) = delete;
+
+        /// \brief  Return a reference to the node's data. Must not be called
+        ///         on the sentinel.
+        T &data() noexcept
+        {
+            return _data;
+        }
+
+        /// \brief  Return a pointer to the node's next node.
+        node_t *next() const noexcept
+        {
+            return _next;
+        }
+
+        /// \brief  Return a pointer to the node's previous node.
+        node_t *prev() const noexcept
+        {
+            return _prev;
+        }
+
+        friend CircularDoubleLinkedList;
+    };
+
+    /// \brief  The type of the allocator used by the list.
+    using allocator_type = Allocator;
+
+    /// \brief  Default-construct an empty CircularDoubleLinkedList.
+    CircularDoubleLinkedList() = default;
+
+    /// \brief  Construct an empty CircularDoubleLinkedList whose nodes are
+    ///         obtained from the given allocator.
+    explicit CircularDoubleLinkedList(const Allocator &allocator)
+      : _allocator(allocator)
+    {
+    }
+
+    CircularDoubleLinkedList(const CircularDoubleLinkedList &) = delete;
+    CircularDoubleLinkedList & operator=(const CircularDoubleLinkedList &) = delete;
+
+    /// \brief  Destroy a Linked List.
+    ///
+    /// Any contained nodes will be removed and their memory reclaimed.
+    ~CircularDoubleLinkedList()
+    {
+        erase();
+    }
+
+    /// \brief  Return a pointer to the head node, or \c end() if the list is
+    ///         empty.
+    node_t *head() const noexcept
+    {
+        return _sentinel._next;
+    }
+
+    /// \brief  Return a pointer to the tail node, or \c end() if the list is
+    ///         empty.
+    node_t *tail() const noexcept
+    {
+        return _sentinel._prev;
+    }
+
+    /// \brief  Return a pointer to the sentinel, which follows the tail and
+    ///         precedes the head.
+    node_t *end() const noexcept
+    {
+        return const_cast<node_t *>(&_sentinel);
+    }
+
+    /// \brief  Return the number of elements in the linked list.
+    size_t size() const noexcept
+    {
+        return _count;
+    }
+
+    /// \brief  Determine if a CircularDoubleLinkedList is empty.
+    ///
+    /// \return \c true  if the list is empty, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return head() == end();
+    }
+
+    /// \brief  Prepend a new item to the beginning of a linked list. The new
+    ///         item becomes the new head of the linked list.
+    ///
+    /// \param data The data to be added to the linked list.
+    /// \return A pointer to the to the prepended node.
+    node_t *prepend(const T &data)
+    {
+        return insert_after(data, end());
+    }
+
+    /// \brief  Insert a new item into the linked list immediately following
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node A pointer to an existing node in the linked list, or
+    ///             \c end() to insert at the head.
+    ///
+    /// \return A pointer to the new item's node.
+    node_t *insert_after(const T &data, node_t *node)
+    {
+        node_t *new_node{create_node(data)};
+        DS_LIST_STATS(_stats.record_allocation(sizeof(node_t));)
+
+        new_node->_prev = node;
+        new_node->_next = node->_next;
+        node->_next->_prev = new_node;
+        node->_next = new_node;
+
+        ++_count;
+        DS_LIST_STATS(_stats.record_size(_count);)
+
+        return new_node;
+    }
+
+    /// \brief  Insert a new item into the linked list immediately preceding
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node A pointer to an existing node in the linked list, or
+    ///             \c end() to insert at the tail.
+    ///
+    /// \return A pointer to the new item's node.
+    node_t *insert_before(const T &data, node_t *node)
+    {
+        return insert_after(data, node->_prev);
+    }
+
+    /// \brief  Append a new item to the end of the linked list.
+    ///
+    /// \param data The data to be appended to the linked list.
+    /// \return A pointer to the appended item's node.
+    node_t *append(const T &data)
+    {
+        return insert_after(data, tail());
+    }
+
+    /// \brief  Remove the specified node from the linked list.
+    ///
+    /// \param node A pointer to the node to be removed. It must not be
+    ///             \c end().
+    /// \return A pointer to the node following the removed node, which is
+    ///         \c end() if the tail was removed.
+    node_t *remove(node_t *node)
+    {
+        node_t *next_node{node->_next};
+
+        node->_prev->_next = next_node;
+        next_node->_prev = node->_prev;
+
+        destroy_node(node);
+        --_count;
+        DS_LIST_STATS(_stats.record_deallocation();)
+
+        return next_node;
+    }
+
+    /// \brief  Erase the linked list. Memory allocated to nodes is reclaimed.
+    void erase()
+    {
+        node_t *current{head()};
+
+        while (current != end())
+        {
+            node_t *next{current->_next};
+
+            destroy_node(current);
+            current = next;
+        }
+
+        DS_LIST_STATS(_stats.record_deallocation(_count);)
+
+        _sentinel._next = _sentinel._prev = end();
+        _count = 0;
+    }
+
+    /// \brief  Abandon every node without visiting it, leaving the list empty.
+    ///
+    /// The nodes are neither destroyed nor returned to the allocator, so the
+    /// cost does not depend on the size of the list. This is intended for
+    /// lists whose allocator draws from an arena, such as ArenaAllocator:
+    /// after \c release the arena can be reset to reclaim every node at once.
+    /// It compiles only for allocators marked by \c releases_in_bulk, since
+    /// with any other allocator the nodes' memory would be leaked.
+    ///
+    /// \remark Type \c T must be trivially destructible.
+    void release() noexcept
+    {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "Only nodes holding trivially destructible data can be released");
+        static_assert(releases_in_bulk<Allocator>::value,
+                      "Only nodes from an allocator that frees them in bulk can be released");
+
+        DS_LIST_STATS(_stats.record_deallocation(_count);)
+
+        _sentinel._next = _sentinel._prev = end();
+        _count = 0;
+    }
+
+    /// \brief  Return a copy of the list's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+    /// \brief  Locate the first node containing the given value.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// \remark Type \c T must be comparable to another object of type \c T
+    ///         via the equality operator (operator==).
+    node_t *find(const T &data)
+    {
+        node_t *current{head()};
+        DS_LIST_STATS(std::uint64_t probes{0};)
+
+        while (current != end())
+        {
+            DS_LIST_STATS(++probes;)
+            if (current->_data == data)
+                break;
+
+            current = current->_next;
+        }
+
+        DS_LIST_STATS(_stats.record_find(probes);)
+
+        return current == end() ? nullptr : current;
+    }
+
+    /// \brief  Return the list's instrumentation counters.
+    ///
+    /// The counters are maintained only when DS_ENABLE_STATS is defined;
+    /// otherwise all of the counters are zero.
+    const ListStats &stats() const noexcept
+    {
+#if defined(DS_ENABLE_STATS)
+        return _stats;
+#else
+        static const ListStats  no_stats{};
+        return no_stats;
+#endif
+    }
+
+    /// \brief  Reset the list's instrumentation counters. The peak size
+    ///         restarts from the current size.
+    void reset_stats() noexcept
+    {
+        DS_LIST_STATS(_stats = ListStats{};)
+        DS_LIST_STATS(_stats.record_size(_count);)
+    }
+
+private:
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // Obtain a node from the allocator and construct it with the given data.
+    node_t *create_node(const T &data)
+    {
+        node_t *node{node_traits::allocate(_allocator, 1)};
+
+        try
+        {
+            node_traits::construct(_allocator, node, data);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, node, 1);
+            throw;
+        }
+
+        return node;
+    }
+
+    // Destroy a node's data and the node, and return its memory to the
+    // allocator.
+    void destroy_node(node_t *node)
+    {
+        node->_data.~T();
+        node_traits::destroy(_allocator, node);
+        node_traits::deallocate(_allocator, node, 1);
+    }
+
+// Instance data
+private:
+    node_allocator  _allocator;     ///< Allocator from which nodes are obtained
+    node_t          _sentinel;      ///< Follows the tail and precedes the head
+    size_t          _count{0};      ///< Number of elements in the linked list
+#if defined(DS_ENABLE_STATS)
+    ListStats   _stats;             ///< Instrumentation counters
+#endif
+};
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  A CircularDoubleLinkedList that allocates its nodes from a
+///         \c std::pmr::memory_resource given to its constructor.
+///
+/// \see    pmr::DoubleLinkedList
+template<typename T>
+using CircularDoubleLinkedList = ::CircularDoubleLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
+#endif // INC_CIRCULAR_DOUBLE_LINKED_LIST
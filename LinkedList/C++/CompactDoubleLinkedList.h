@@ -0,0 +1,295 @@
+/// \file   CompactDoubleLinkedList.h
+/// \brief  Implementation of a memory-compact doubly-linked list in C++
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_COMPACT_DOUBLE_LINKED_LIST
+#define INC_COMPACT_DOUBLE_LINKED_LIST
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/// \brief  A doubly-linked list whose nodes live in a single pool and are
+///         linked with 32-bit indices rather than pointers.
+///
+/// Each node of a DoubleLinkedList carries two pointers, which on a 64-bit
+/// platform is sixteen bytes of overhead per element. The nodes of a
+/// CompactDoubleLinkedList are stored contiguously in a pool and refer to
+/// each other by their 32-bit position in that pool, halving the link
+/// overhead and removing the per-node heap allocation.
+///
+/// Nodes are identified by an \c index_t handle rather than a pointer.
+/// A handle remains valid until its node is removed, even when the pool
+/// grows. The value \c npos plays the role that \c nullptr plays for
+/// DoubleLinkedList.
+///
+/// Slots of removed nodes are kept on a free list and reused by later
+/// insertions, so memory is returned to the system only by erase() or
+/// destruction of the list.
+///
+/// \remark Type \c T must be trivially destructible, since the element in
+///         a removed node's slot is simply overwritten when the slot is
+///         reused.
+template<typename T>
+class CompactDoubleLinkedList
+{
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "CompactDoubleLinkedList requires a trivially destructible type");
+
+public:
+    /// \brief  Type used to identify a node in the list.
+    using index_t = std::uint32_t;
+
+    /// \brief  The handle value that does not refer to any node.
+    static constexpr index_t npos = UINT32_MAX;
+
+    /// \brief  Default-construct an empty CompactDoubleLinkedList.
+    CompactDoubleLinkedList() = default;
+
+    CompactDoubleLinkedList(const CompactDoubleLinkedList &) = delete;
+    CompactDoubleLinkedList & operator=(const CompactDoubleLinkedList &) = delete;
+
+    /// \brief  Return the handle of the head node.
+    index_t head() const noexcept
+    {
+        return _head_node;
+    }
+
+    /// \brief  Return the handle of the tail node.
+    index_t tail() const noexcept
+    {
+        return _tail_node;
+    }
+
+    /// \brief  Return the handle of the node following the given node.
+    index_t next(index_t node) const noexcept
+    {
+        return _nodes[node]._next;
+    }
+
+    /// \brief  Return the handle of the node preceding the given node.
+    index_t prev(index_t node) const noexcept
+    {
+        return _nodes[node]._prev;
+    }
+
+    /// \brief  Return a reference to the data held by the given node.
+    T &data(index_t node) noexcept
+    {
+        return _nodes[node]._data;
+    }
+
+    /// \brief  Return a reference to the data held by the given node.
+    const T &data(index_t node) const noexcept
+    {
+        return _nodes[node]._data;
+    }
+
+    /// \brief  Return the number of elements in the linked list.
+    size_t size() const noexcept
+    {
+        return _count;
+    }
+
+    /// \brief  Determine if a CompactDoubleLinkedList is empty.
+    ///
+    /// \return \c true  if the CompactDoubleLinkedList is empty, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return _head_node == npos;
+    }
+
+    /// \brief  Reserve pool space for at least \p count nodes.
+    void reserve(size_t count)
+    {
+        _nodes.reserve(count);
+    }
+
+    /// \brief  Return the number of bytes of memory used by the list.
+    ///
+    /// The report includes the list object itself and the entire node pool,
+    /// including slots reserved for growth and slots on the free list.
+    size_t memory_footprint() const noexcept
+    {
+        return sizeof(*this) + _nodes.capacity() * sizeof(node);
+    }
+
+    /// \brief  Prepend a new item to the beginning of a linked list. The new
+    ///         item becomes the new head of the linked list.
+    ///
+    /// \param data The data to be added to the linked list.
+    /// \return The handle of the prepended node.
+    index_t prepend(const T &data)
+    {
+        index_t new_node{allocate_node(data)};
+
+        _nodes[new_node]._next = _head_node;
+        if (is_empty())
+            _tail_node = new_node;
+        else
+            _nodes[_head_node]._prev = new_node;
+        _head_node = new_node;
+
+        ++_count;
+
+        return new_node;
+    }
+
+    /// \brief  Insert a new item into the linked list immediately following
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node The handle of an existing node in the linked list.
+    ///
+    /// \return The handle of the new item's node.
+    index_t insert_after(const T &data, index_t node)
+    {
+        index_t new_node{allocate_node(data)};
+        index_t next_node{_nodes[node]._next};
+
+        _nodes[new_node]._next = next_node;
+        _nodes[new_node]._prev = node;
+        _nodes[node]._next = new_node;
+        if (next_node == npos)
+            _tail_node = new_node;
+        else
+            _nodes[next_node]._prev = new_node;
+
+        ++_count;
+
+        return new_node;
+    }
+
+    /// \brief  Insert a new item into the linked list immediately preceding
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node The handle of an existing node in the linked list.
+    ///
+    /// \return The handle of the new item's node.
+    index_t insert_before(const T &data, index_t node)
+    {
+        return node == head() ? prepend(data)
+                              : insert_after(data, prev(node));
+    }
+
+    /// \brief  Append a new item to the end of the linked list.
+    ///
+    /// \param data The data to be appended to the linked list.
+    /// \return The handle of the appended item's node.
+    index_t append(const T &data)
+    {
+        return is_empty() ? prepend(data)
+                          : insert_after(data, tail());
+    }
+
+    /// \brief  Remove the specified node from the linked list.
+    ///
+    /// \param node The handle of the node to be removed.
+    /// \return The handle of the node following the removed node.
+    index_t remove(index_t node)
+    {
+        index_t next_node{_nodes[node]._next};
+        index_t prev_node{_nodes[node]._prev};
+
+        if (prev_node == npos)
+            _head_node = next_node;
+        else
+            _nodes[prev_node]._next = next_node;
+
+        if (next_node == npos)
+            _tail_node = prev_node;
+        else
+            _nodes[next_node]._prev = prev_node;
+
+        // Thread the freed slot onto the free list.
+        _nodes[node]._next = _free_node;
+        _free_node = node;
+        --_count;
+
+        return next_node;
+    }
+
+    /// \brief  Erase the linked list. The node pool is released.
+    void erase()
+    {
+        std::vector<node>().swap(_nodes);
+        _head_node = _tail_node = _free_node = npos;
+        _count = 0;
+    }
+
+    /// \brief  Locate the first node containing the given value.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return The handle of the list node containing the specified value,
+    ///         or \c npos if the data item was not found.
+    ///
+    /// \remark Type \c T must be comparable to another object of type \c T
+    ///         via the equality operator (operator==).
+    index_t find(const T &data) const
+    {
+        index_t current{head()};
+
+        while (current != npos)
+        {
+            if (_nodes[current]._data == data)
+                break;
+
+            current = _nodes[current]._next;
+        }
+
+        return current;
+    }
+
+private:
+    // A node in the pool. The links are positions in the pool, not pointers.
+    struct node
+    {
+        T       _data;  // Data contained in the node
+        index_t _next;  // Index of the next node, or of the next free slot
+        index_t _prev;  // Index of the previous node
+    };
+
+    // Obtain a slot for a new node, preferring a previously freed slot.
+    index_t allocate_node(const T &data)
+    {
+        index_t new_node;
+
+        if (_free_node != npos)
+        {
+            new_node = _free_node;
+            _free_node = _nodes[new_node]._next;
+            ::new (static_cast<void *>(&_nodes[new_node]._data)) T(data);
+        }
+        else
+        {
+            if (_nodes.size() >= npos)
+                throw std::length_error("CompactDoubleLinkedList is full");
+
+            new_node = static_cast<index_t>(_nodes.size());
+            _nodes.push_back(node{data, npos, npos});
+        }
+
+        _nodes[new_node]._next = _nodes[new_node]._prev = npos;
+
+        return new_node;
+    }
+
+// Instance data
+private:
+    std::vector<node>   _nodes;             ///< Pool holding every node
+    index_t _head_node{npos};               ///< Index of the head node
+    index_t _tail_node{npos};               ///< Index of the tail node
+    index_t _free_node{npos};               ///< Index of the first free slot
+    size_t  _count{0};                      ///< Number of elements in the linked list
+};
+
+template<typename T>
+constexpr typename CompactDoubleLinkedList<T>::index_t CompactDoubleLinkedList<T>::npos;
+
+#endif // INC_COMPACT_DOUBLE_LINKED_LIST
@@ -0,0 +1,335 @@
+/// \file   ConcurrentDoubleLinkedList.h
+/// \brief  A doubly-linked list that may be used by several threads at once
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_CONCURRENT_DOUBLE_LINKED_LIST
+#define INC_CONCURRENT_DOUBLE_LINKED_LIST
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/// \brief  A doubly-linked list with a lock in every node, so that threads
+///         working on different parts of the list do not wait for each other.
+///
+/// \tparam T           The type of the elements held by the list.
+/// \tparam Allocator   The allocator from which the list's nodes are
+///                     obtained. It is rebound to the node type, and must be
+///                     safe to use from several threads at once.
+///
+/// Searches walk the list by lock coupling (hand-over-hand locking): the
+/// lock of the next node is taken before that of the current node is
+/// released, so a search never looks at a node that another thread is
+/// changing. A change locks only the nodes whose links it rewrites, always
+/// from the head towards the tail, so changes to different parts of the list
+/// proceed at the same time. The one step against that order, finding the
+/// last node from the tail, only tries its lock and starts again if it is
+/// taken, so threads cannot deadlock.
+///
+/// Because another thread may remove any node at any moment, the list does
+/// not hand out pointers to its nodes. Positions are named by value instead:
+/// \c insert_after, \c insert_before and \c remove act on the first node
+/// holding a given value.
+///
+/// Every step of a search takes a lock, so a single thread runs much slower
+/// than with DoubleLinkedList. The list pays off when many threads change a
+/// long list at once.
+template<typename T, typename Allocator = std::allocator<T>>
+class ConcurrentDoubleLinkedList
+{
+public:
+    /// \brief  The type of the allocator used by the list.
+    using allocator_type = Allocator;
+
+    /// \brief  Construct an empty ConcurrentDoubleLinkedList.
+    ConcurrentDoubleLinkedList()
+    {
+        _head.next = &_tail;
+        _tail.prev = &_head;
+    }
+
+    /// \brief  Construct an empty ConcurrentDoubleLinkedList whose nodes are
+    ///         obtained from the given allocator.
+    explicit ConcurrentDoubleLinkedList(const Allocator &allocator)
+      : _allocator(allocator)
+    {
+        _head.next = &_tail;
+        _tail.prev = &_head;
+    }
+
+    ConcurrentDoubleLinkedList(const ConcurrentDoubleLinkedList &) = delete;
+    ConcurrentDoubleLinkedList & operator=(const ConcurrentDoubleLinkedList &) = delete;
+
+    /// \brief  Destroy the list and reclaim its nodes. No other thread may be
+    ///         using the list.
+    ~ConcurrentDoubleLinkedList()
+    {
+        link_t *current{_head.next};
+
+        while (current != &_tail)
+        {
+            link_t *next{current->next};
+
+            destroy_node(static_cast<node_t *>(current));
+            current = next;
+        }
+    }
+
+    /// \brief  Return the number of elements in the list. If other threads
+    ///         are changing the list, the result may already be out of date.
+    size_t size() const noexcept
+    {
+        return _count.load(std::memory_order_relaxed);
+    }
+
+    /// \brief  Determine if the list is empty. If other threads are changing
+    ///         the list, the result may already be out of date.
+    bool is_empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /// \brief  Add a new item to the beginning of the list.
+    ///
+    /// \param data The data to be added to the list.
+    void prepend(const T &data)
+    {
+        node_t *new_node{create_node(data)};
+
+        std::lock_guard<std::mutex> head_lock(_head.mutex);
+        std::lock_guard<std::mutex> next_lock(_head.next->mutex);
+
+        link(new_node, &_head, _head.next);
+    }
+
+    /// \brief  Add a new item to the end of the list.
+    ///
+    /// \param data The data to be added to the list.
+    void append(const T &data)
+    {
+        node_t *new_node{create_node(data)};
+
+        for (;;)
+        {
+            // While the tail is locked its predecessor cannot be removed, but
+            // waiting for the predecessor's lock here could deadlock with a
+            // thread moving towards the tail, so only try it.
+            std::unique_lock<std::mutex>    tail_lock(_tail.mutex);
+            link_t                         *last{_tail.prev};
+            std::unique_lock<std::mutex>    last_lock(last->mutex, std::try_to_lock);
+
+            if (last_lock.owns_lock())
+            {
+                link(new_node, last, &_tail);
+                return;
+            }
+
+            tail_lock.unlock();
+            std::this_thread::yield();
+        }
+    }
+
+    /// \brief  Insert a new item immediately following the first node that
+    ///         holds a given value.
+    ///
+    /// \param data     The data to be inserted into the list.
+    /// \param existing The value after which to insert.
+    ///
+    /// \return \c true if the new item was inserted, or \c false if no node
+    ///         holds \p existing.
+    bool insert_after(const T &data, const T &existing)
+    {
+        node_t *new_node{create_node(data)};
+        bool    found{locate(existing, [&](link_t *, link_t *current)
+                            {
+                                std::lock_guard<std::mutex> next_lock(current->next->mutex);
+
+                                link(new_node, current, current->next);
+                            })};
+
+        if (!found)
+            destroy_node(new_node);
+
+        return found;
+    }
+
+    /// \brief  Insert a new item immediately preceding the first node that
+    ///         holds a given value.
+    ///
+    /// \param data     The data to be inserted into the list.
+    /// \param existing The value before which to insert.
+    ///
+    /// \return \c true if the new item was inserted, or \c false if no node
+    ///         holds \p existing.
+    bool insert_before(const T &data, const T &existing)
+    {
+        node_t *new_node{create_node(data)};
+        bool    found{locate(existing, [&](link_t *previous, link_t *current)
+                            {
+                                link(new_node, previous, current);
+                            })};
+
+        if (!found)
+            destroy_node(new_node);
+
+        return found;
+    }
+
+    /// \brief  Remove the first node that holds a given value.
+    ///
+    /// \param data The value to be removed.
+    ///
+    /// \return \c true if a node was removed, or \c false if no node holds
+    ///         \p data.
+    bool remove(const T &data)
+    {
+        link_t *removed{nullptr};
+        bool    found{locate(data, [&](link_t *previous, link_t *current)
+                            {
+                                std::lock_guard<std::mutex> next_lock(current->next->mutex);
+
+                                previous->next = current->next;
+                                current->next->prev = previous;
+                                removed = current;
+                            })};
+
+        // Any thread that could reach the removed node would have had to lock
+        // its predecessor first, so once the locks are released the node can
+        // be reclaimed.
+        if (found)
+        {
+            --_count;
+            destroy_node(static_cast<node_t *>(removed));
+        }
+
+        return found;
+    }
+
+    /// \brief  Determine whether any node holds a given value.
+    bool contains(const T &data)
+    {
+        return locate(data, [](link_t *, link_t *) {});
+    }
+
+    /// \brief  Call a function with the data of every node, from head to
+    ///         tail. Each node is locked while the function is called, so the
+    ///         function may modify the data, but must not use the list.
+    template<typename Function>
+    void for_each(Function func)
+    {
+        std::unique_lock<std::mutex>    previous_lock(_head.mutex);
+        link_t                         *current{_head.next};
+        std::unique_lock<std::mutex>    current_lock(current->mutex);
+
+        while (current != &_tail)
+        {
+            func(static_cast<node_t *>(current)->data);
+
+            previous_lock = std::move(current_lock);
+            current = current->next;
+            current_lock = std::unique_lock<std::mutex>(current->mutex);
+        }
+    }
+
+    /// \brief  Return a copy of the allocator used by the list.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+private:
+    // The links of a node. The head and tail sentinels hold no data.
+    struct link_t
+    {
+        std::mutex  mutex;
+        link_t     *prev{nullptr};
+        link_t     *next{nullptr};
+    };
+
+    struct node_t : link_t
+    {
+        explicit node_t(const T &value)
+          : data{value}
+        {}
+
+        T   data;
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // Link a new node between two adjacent nodes, both of which are locked.
+    void link(node_t *node, link_t *previous, link_t *next) noexcept
+    {
+        node->prev = previous;
+        node->next = next;
+        previous->next = node;
+        next->prev = node;
+        ++_count;
+    }
+
+    // Search for the first node holding a value by lock coupling. If one is
+    // found, call action with it and its predecessor, both locked.
+    template<typename Action>
+    bool locate(const T &data, Action action)
+    {
+        std::unique_lock<std::mutex>    previous_lock(_head.mutex);
+        link_t                         *previous{&_head};
+        link_t                         *current{_head.next};
+        std::unique_lock<std::mutex>    current_lock(current->mutex);
+
+        while (current != &_tail)
+        {
+            if (static_cast<node_t *>(current)->data == data)
+            {
+                action(previous, current);
+                return true;
+            }
+
+            // Moving the lock releases the one it replaces.
+            previous_lock = std::move(current_lock);
+            previous = current;
+            current = current->next;
+            current_lock = std::unique_lock<std::mutex>(current->mutex);
+        }
+
+        return false;
+    }
+
+    // Obtain a node from the allocator and construct it with the given data.
+    node_t *create_node(const T &data)
+    {
+        node_t *node{node_traits::allocate(_allocator, 1)};
+
+        try
+        {
+            node_traits::construct(_allocator, node, data);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, node, 1);
+            throw;
+        }
+
+        return node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node_t *node)
+    {
+        node_traits::destroy(_allocator, node);
+        node_traits::deallocate(_allocator, node, 1);
+    }
+
+// Instance data
+private:
+    node_allocator      _allocator;     ///< Allocator from which nodes are obtained
+    link_t              _head;          ///< Sentinel preceding the first node
+    link_t              _tail;          ///< Sentinel following the last node
+    std::atomic<size_t> _count{0};      ///< Number of elements in the list
+};
+
+#endif // INC_CONCURRENT_DOUBLE_LINKED_LIST
@@ -0,0 +1,251 @@
+/// \file   EpochReclamation.h
+/// \brief  Epoch-based reclamation of nodes removed from lock-free structures
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_EPOCH_RECLAMATION
+#define INC_EPOCH_RECLAMATION
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief  Decides when memory unlinked from a lock-free structure can be
+///         freed, shared by any number of structures.
+///
+/// A thread removing a node from a lock-free list cannot free it at once,
+/// because other threads may still be reading it. Instead each thread
+/// announces, by holding a \c guard, that it is inside an operation, and
+/// records the global epoch it saw on entry. Removed nodes are handed to
+/// \c retire, tagged with the current epoch. The global epoch only moves
+/// forward once every thread inside an operation has seen it, so a node
+/// retired two epochs ago can no longer be reached by anyone and is freed.
+///
+/// Entering and leaving an operation costs one atomic exchange on a slot
+/// that is usually private to the thread. Retiring a node takes a mutex,
+/// which is acceptable since removals are far rarer than reads.
+class EpochDomain
+{
+public:
+    /// \brief  Announces that the current thread is inside an operation for
+    ///         as long as it exists. Pointers read from a structure using the
+    ///         domain remain valid until the guard is destroyed.
+    class guard
+    {
+    public:
+        explicit guard(EpochDomain &domain)
+          : _domain{domain},
+            _slot{domain.enter()}
+        {}
+
+        guard(const guard &) = delete;
+        guard & operator=(const guard &) = delete;
+
+        ~guard()
+        {
+            _domain.leave(_slot);
+        }
+
+    private:
+        EpochDomain    &_domain;
+        size_t          _slot;
+    };
+
+    /// \brief  A function that frees a retired object, given the object and
+    ///         the context passed to \c retire.
+    using reclaim_function = void (*)(void *object, void *context);
+
+    EpochDomain() = default;
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain & operator=(const EpochDomain &) = delete;
+
+    /// \brief  Free every object still waiting. No thread may be using a
+    ///         structure that retires objects to the domain.
+    ~EpochDomain()
+    {
+        for (auto &item : _retired)
+            item.reclaim(item.object, item.context);
+    }
+
+    /// \brief  Return the domain shared by default by every structure.
+    static EpochDomain &shared()
+    {
+        static EpochDomain  domain;
+        return domain;
+    }
+
+    /// \brief  Hand over an object that has been unlinked, to be freed once
+    ///         no thread can still be reading it.
+    ///
+    /// \param object   The object to be freed.
+    /// \param reclaim  The function that frees it, called as
+    ///                 \c reclaim(object, context).
+    /// \param context  Passed through to \p reclaim, typically the structure
+    ///                 the object came from.
+    void retire(void *object, reclaim_function reclaim, void *context)
+    {
+        std::vector<retired_object> ready;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            _retired.push_back({object, reclaim, context, _epoch.load()});
+            if (_retired.size() < _collect_at)
+                return;
+
+            try_advance();
+            collect(ready, [this](const retired_object &item)
+                           {
+                               return item.epoch + 2 <= _epoch.load();
+                           });
+
+            // If a slow thread is holding the epoch back, wait for more to
+            // build up before looking again, so that retiring stays cheap.
+            _collect_at = std::max(collect_threshold, _retired.size() * 2);
+        }
+
+        // Free the objects without holding the lock.
+        for (auto &item : ready)
+            item.reclaim(item.object, item.context);
+    }
+
+    /// \brief  Free every waiting object that was retired with the given
+    ///         context, whether or not its grace period has passed.
+    ///
+    /// Called by a structure being destroyed, when no thread can be reading
+    /// its objects any longer.
+    void drain(void *context)
+    {
+        std::vector<retired_object> ready;
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            collect(ready, [context](const retired_object &item)
+                           {
+                               return item.context == context;
+                           });
+        }
+
+        for (auto &item : ready)
+            item.reclaim(item.object, item.context);
+    }
+
+    /// \brief  Return the number of objects waiting to be freed.
+    size_t pending() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _retired.size();
+    }
+
+private:
+    // Retired objects are examined once this many are waiting.
+    static constexpr size_t collect_threshold{64};
+
+    // The number of threads that can be inside operations at once. A thread
+    // finding every slot taken waits for one to be released.
+    static constexpr size_t slot_count{128};
+
+    // A slot value showing that no thread is using it.
+    static constexpr std::uint64_t idle{0};
+
+    struct alignas(64) slot_t
+    {
+        std::atomic<std::uint64_t>  epoch{idle};
+    };
+
+    struct retired_object
+    {
+        void               *object;
+        reclaim_function    reclaim;
+        void               *context;
+        std::uint64_t       epoch;
+    };
+
+    // Claim a slot and publish the current epoch in it, returning the slot.
+    size_t enter()
+    {
+        static thread_local size_t  hint{std::hash<std::thread::id>{}(std::this_thread::get_id())};
+
+        for (size_t i{hint % slot_count}; ; i = (i + 1) % slot_count)
+        {
+            std::uint64_t   epoch{_epoch.load()};
+            std::uint64_t   expected{idle};
+
+            if (_slots[i].epoch.compare_exchange_strong(expected, epoch))
+            {
+                // If the epoch moved on before the slot was published, the
+                // objects retired in the epoch seen may already be gone, so
+                // publish the newer one.
+                std::uint64_t   current;
+
+                while ((current = _epoch.load()) != epoch)
+                {
+                    epoch = current;
+                    _slots[i].epoch.store(epoch);
+                }
+
+                hint = i;
+                return i;
+            }
+
+            if ((i + 1) % slot_count == hint % slot_count)
+                std::this_thread::yield();
+        }
+    }
+
+    void leave(size_t slot) noexcept
+    {
+        _slots[slot].epoch.store(idle, std::memory_order_release);
+    }
+
+    // Move the global epoch forward if every thread inside an operation has
+    // seen the current one. Called with the mutex held.
+    void try_advance()
+    {
+        std::uint64_t   epoch{_epoch.load()};
+
+        for (auto &slot : _slots)
+        {
+            std::uint64_t   seen{slot.epoch.load()};
+
+            if (seen != idle && seen != epoch)
+                return;
+        }
+
+        _epoch.compare_exchange_strong(epoch, epoch + 1);
+    }
+
+    // Move the retired objects satisfying a predicate to another vector.
+    // Called with the mutex held.
+    template<typename Predicate>
+    void collect(std::vector<retired_object> &ready, Predicate pred)
+    {
+        size_t  kept{0};
+
+        for (auto &item : _retired)
+        {
+            if (pred(item))
+                ready.push_back(item);
+            else
+                _retired[kept++] = item;
+        }
+
+        _retired.resize(kept);
+    }
+
+// Instance data
+private:
+    std::atomic<std::uint64_t>  _epoch{1};          ///< The global epoch
+    slot_t                      _slots[slot_count]; ///< Epochs seen by threads in operations
+    mutable std::mutex          _mutex;             ///< Guards the retired objects
+    std::vector<retired_object> _retired;           ///< Objects waiting to be freed
+    size_t                      _collect_at{collect_threshold}; ///< Size prompting a collection
+};
+
+#endif // INC_EPOCH_RECLAMATION
@@ -0,0 +1,582 @@
+/// \file   IndexedList.h
+/// \brief  A doubly-linked list with logarithmic access by position
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_INDEXED_LIST
+#define INC_INDEXED_LIST
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+#include <new>
+#include <stdexcept>
+
+#include "ListStats.h"
+
+/// \brief  A doubly-linked list whose elements can also be reached, inserted
+///         and removed by position in logarithmic time.
+///
+/// \tparam T           The type of the elements held by the list.
+/// \tparam Allocator   The allocator from which the list's nodes are
+///                     obtained. It is rebound to the node type.
+///
+/// The list is an indexable skip list. Every node is on the bottom level,
+/// which is an ordinary doubly-linked list, and is also on a random number
+/// of higher levels, each holding about a quarter of the nodes of the level
+/// below. Each forward link records how many nodes it passes over, so a
+/// search by position skips whole runs of nodes, and a node's position is
+/// found by following links from the node to the end of the list. All of
+/// these take O(log n) steps on average.
+///
+/// The interface follows DoubleLinkedList, with \c at, \c insert_at,
+/// \c erase_at and \c index_of added. Because every change must adjust the
+/// counts along its path, \c append, \c prepend, \c insert_after,
+/// \c insert_before and \c remove also take O(log n) time rather than O(1).
+template<typename T, typename Allocator = std::allocator<T>>
+class IndexedList
+{
+    class link_t;
+
+public:
+    /// \brief  The linked list node structure.
+    ///
+    /// This class holds the list element's data and the pointer to the
+    /// previous node. The node's forward links, one for each level it is on,
+    /// are stored immediately after it in the same allocation.
+    class node_t
+    {
+    private:
+        T           _data;          ///< Data contained in the node
+        node_t     *_prev{nullptr}; ///< Pointer to the previous node
+        unsigned    _level;         ///< Number of levels the node is on
+
+    public:
+        node_t(const T &data, unsigned level)
+          : _data{data},
+            _level{level}
+        {}
+
+        node_t(const node_t &) = delete;
+        node_t & operator=(const node_t &) = delete;
+
+        /// \brief  Return a reference to the node's data.
+        T &data() noexcept
+        {
+            return _data;
+        }
+
+        /// \brief  Return a pointer to the node's next node.
+        node_t *next() const noexcept
+        {
+            return links()[0].next;
+        }
+
+        /// \brief  Return a pointer to the node's previous node.
+        node_t *prev() const noexcept
+        {
+            return _prev;
+        }
+
+    private:
+        link_t *links() const noexcept
+        {
+            return reinterpret_cast<link_t *>(const_cast<node_t *>(this + 1));
+        }
+
+        friend IndexedList;
+    };
+
+    /// \brief  The type of the allocator used by the list.
+    using allocator_type = Allocator;
+
+    /// \brief  Default-construct an empty IndexedList.
+    IndexedList() = default;
+
+    /// \brief  Construct an empty IndexedList whose nodes are obtained from
+    ///         the given allocator.
+    explicit IndexedList(const Allocator &allocator)
+      : _allocator(allocator)
+    {
+    }
+
+    IndexedList(const IndexedList &) = delete;
+    IndexedList & operator=(const IndexedList &) = delete;
+
+    /// \brief  Destroy a Linked List.
+    ///
+    /// Any contained nodes will be removed and their memory reclaimed.
+    ~IndexedList()
+    {
+        erase();
+    }
+
+    /// \brief  Return a pointer to the head node
+    node_t *head() const noexcept
+    {
+        return _head[0].next;
+    }
+
+    /// \brief  Return a pointer to the tail node.
+    node_t *tail() const noexcept
+    {
+        return _tail_node;
+    }
+
+    /// \brief  Return the number of elements in the linked list.
+    size_t size() const noexcept
+    {
+        return _count;
+    }
+
+    /// \brief  Determine if an IndexedList is empty.
+    ///
+    /// \return \c true if the list is empty, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return head() == nullptr;
+    }
+
+    /// \brief  Return a reference to the element at a position.
+    ///
+    /// \param index    The position of the element, counting from zero.
+    ///
+    /// \throw std::out_of_range if \p index is not less than \c size().
+    T &at(size_t index)
+    {
+        return node_at(index)->_data;
+    }
+
+    /// \brief  Return a reference to the element at a position.
+    ///
+    /// \throw std::out_of_range if \p index is not less than \c size().
+    const T &at(size_t index) const
+    {
+        return node_at(index)->_data;
+    }
+
+    /// \brief  Return a pointer to the node at a position.
+    ///
+    /// \param index    The position of the node, counting from zero.
+    ///
+    /// \throw std::out_of_range if \p index is not less than \c size().
+    node_t *node_at(size_t index) const
+    {
+        if (index >= _count)
+            throw std::out_of_range("IndexedList::node_at: index out of range");
+
+        // The head is at rank 0 and the element at index i at rank i + 1.
+        const link_t   *links{_head};
+        node_t         *current{nullptr};
+        size_t          rank{0};
+
+        for (unsigned level = _level; level-- > 0; )
+        {
+            while (links[level].next != nullptr && rank + links[level].width <= index + 1)
+            {
+                rank += links[level].width;
+                current = links[level].next;
+                links = current->links();
+            }
+        }
+
+        return current;
+    }
+
+    /// \brief  Return the position of a node in the list, counting from zero.
+    ///
+    /// \param node A pointer to an existing node in the list.
+    size_t index_of(const node_t *node) const noexcept
+    {
+        // Following each node's highest link leads to the end of the list in
+        // O(log n) steps, and the counts along the way give the distance,
+        // which includes one step past the tail.
+        size_t  distance{0};
+
+        while (node != nullptr)
+        {
+            const link_t   &top{node->links()[node->_level - 1]};
+
+            distance += top.width;
+            node = top.next;
+        }
+
+        return _count - distance;
+    }
+
+    /// \brief  Insert a new item so that it is at the given position.
+    ///
+    /// \param index    The position of the new item, from 0 to \c size().
+    /// \param data     The data to be inserted into the list.
+    ///
+    /// \return A pointer to the new item's node.
+    ///
+    /// \throw std::out_of_range if \p index is greater than \c size().
+    node_t *insert_at(size_t index, const T &data)
+    {
+        if (index > _count)
+            throw std::out_of_range("IndexedList::insert_at: index out of range");
+
+        link_t     *update[max_level]{};
+        size_t      rank[max_level]{};
+
+        find_predecessors(index, update, rank);
+
+        unsigned    level{random_level()};
+        node_t     *new_node{create_node(data, level)};
+        link_t     *links{new_node->links()};
+        DS_LIST_STATS(_stats.record_allocation(node_bytes(level));)
+
+        // New levels start at the head and reach the end of the list.
+        for (; _level < level; ++_level)
+        {
+            _head[_level].next = nullptr;
+            _head[_level].width = _count + 1;
+            update[_level] = &_head[_level];
+            rank[_level] = 0;
+        }
+
+        for (unsigned i = 0; i < level; ++i)
+        {
+            size_t  before{index - rank[i]};
+
+            links[i].next = update[i]->next;
+            links[i].width = update[i]->width - before;
+            update[i]->next = new_node;
+            update[i]->width = before + 1;
+        }
+
+        // Higher links passing over the new node now pass over one more.
+        for (unsigned i = level; i < _level; ++i)
+            ++update[i]->width;
+
+        new_node->_prev = update[0] == &_head[0] ? nullptr : owner(update[0]);
+        if (links[0].next == nullptr)
+            _tail_node = new_node;
+        else
+            links[0].next->_prev = new_node;
+
+        ++_count;
+        DS_LIST_STATS(_stats.record_size(_count);)
+
+        return new_node;
+    }
+
+    /// \brief  Remove the item at the given position.
+    ///
+    /// \param index    The position of the item, counting from zero.
+    ///
+    /// \return A pointer to the node following the removed node, or
+    ///         \c nullptr if the tail was removed.
+    ///
+    /// \throw std::out_of_range if \p index is not less than \c size().
+    node_t *erase_at(size_t index)
+    {
+        if (index >= _count)
+            throw std::out_of_range("IndexedList::erase_at: index out of range");
+
+        link_t     *update[max_level]{};
+        size_t      rank[max_level]{};
+
+        find_predecessors(index, update, rank);
+
+        node_t     *node{update[0]->next};
+        link_t     *links{node->links()};
+        node_t     *next_node{links[0].next};
+
+        for (unsigned i = 0; i < _level; ++i)
+        {
+            if (update[i]->next == node)
+            {
+                update[i]->width += links[i].width - 1;
+                update[i]->next = links[i].next;
+            }
+            else
+            {
+                --update[i]->width;
+            }
+        }
+
+        if (next_node == nullptr)
+            _tail_node = node->_prev;
+        else
+            next_node->_prev = node->_prev;
+
+        while (_level > 1 && _head[_level - 1].next == nullptr)
+            --_level;
+
+        destroy_node(node);
+        --_count;
+        DS_LIST_STATS(_stats.record_deallocation();)
+
+        return next_node;
+    }
+
+    /// \brief  Prepend a new item to the beginning of a linked list. The new
+    ///         item becomes the new head of the linked list.
+    ///
+    /// \param data The data to be added to the linked list.
+    /// \return A pointer to the to the prepended node.
+    node_t *prepend(const T &data)
+    {
+        return insert_at(0, data);
+    }
+
+    /// \brief  Insert a new item into the linked list immediately following
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node A pointer to an existing node in the linked list.
+    ///
+    /// \return A pointer to the new item's node.
+    node_t *insert_after(const T &data, node_t *node)
+    {
+        return insert_at(index_of(node) + 1, data);
+    }
+
+    /// \brief  Insert a new item into the linked list immediately preceding
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node A pointer to an existing node in the linked list.
+    ///
+    /// \return A pointer to the new item's node.
+    node_t *insert_before(const T &data, node_t *node)
+    {
+        return insert_at(index_of(node), data);
+    }
+
+    /// \brief  Append a new item to the end of the linked list.
+    ///
+    /// \param data The data to be appended to the linked list.
+    /// \return A pointer to the appended item's node.
+    node_t *append(const T &data)
+    {
+        return insert_at(_count, data);
+    }
+
+    /// \brief  Remove the specified node from the linked list.
+    ///
+    /// \param node A pointer to the node to be removed.
+    /// \return A pointer to the node following the removed node.
+    node_t *remove(node_t *node)
+    {
+        return erase_at(index_of(node));
+    }
+
+    /// \brief  Erase the linked list. Memory allocated to nodes is reclaimed.
+    void erase()
+    {
+        node_t *current{head()};
+
+        while (current != nullptr)
+        {
+            node_t *next{current->next()};
+
+            destroy_node(current);
+            current = next;
+        }
+
+        DS_LIST_STATS(_stats.record_deallocation(_count);)
+
+        _head[0].next = nullptr;
+        _head[0].width = 1;
+        _level = 1;
+        _tail_node = nullptr;
+        _count = 0;
+    }
+
+    /// \brief  Return a copy of the list's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+    /// \brief  Locate the first node containing the given value.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// \remark Type \c T must be comparable to another object of type \c T
+    ///         via the equality operator (operator==). The elements are not
+    ///         ordered, so the search visits the nodes one by one.
+    node_t *find(const T &data)
+    {
+        node_t *current{head()};
+        DS_LIST_STATS(std::uint64_t probes{0};)
+
+        while (current != nullptr)
+        {
+            DS_LIST_STATS(++probes;)
+            if (current->_data == data)
+                break;
+
+            current = current->next();
+        }
+
+        DS_LIST_STATS(_stats.record_find(probes);)
+
+        return current;
+    }
+
+    /// \brief  Return the list's instrumentation counters.
+    ///
+    /// The counters are maintained only when DS_ENABLE_STATS is defined;
+    /// otherwise all of the counters are zero.
+    const ListStats &stats() const noexcept
+    {
+#if defined(DS_ENABLE_STATS)
+        return _stats;
+#else
+        static const ListStats  no_stats{};
+        return no_stats;
+#endif
+    }
+
+    /// \brief  Reset the list's instrumentation counters. The peak size
+    ///         restarts from the current size.
+    void reset_stats() noexcept
+    {
+        DS_LIST_STATS(_stats = ListStats{};)
+        DS_LIST_STATS(_stats.record_size(_count);)
+    }
+
+private:
+    // The most levels a node can be on, enough for any list that fits in
+    // memory when each level holds a quarter of the nodes of the one below.
+    static constexpr unsigned max_level{32};
+
+    // A forward link on one level, and the number of bottom-level steps it
+    // takes. A link to the end of the list counts the end as one step past
+    // the tail.
+    class link_t
+    {
+    public:
+        node_t *next{nullptr};
+        size_t  width{1};
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // The number of node-sized units allocated for a node and its links.
+    static size_t node_units(unsigned level) noexcept
+    {
+        return 1 + (level * sizeof(link_t) + sizeof(node_t) - 1) / sizeof(node_t);
+    }
+
+    static size_t node_bytes(unsigned level) noexcept
+    {
+        return node_units(level) * sizeof(node_t);
+    }
+
+    // Return the node whose links begin at the given address.
+    static node_t *owner(link_t *links) noexcept
+    {
+        return reinterpret_cast<node_t *>(links) - 1;
+    }
+
+    // Choose the number of levels for a new node: each further level with
+    // probability one quarter.
+    unsigned random_level() noexcept
+    {
+        _random_state ^= _random_state << 13;
+        _random_state ^= _random_state >> 7;
+        _random_state ^= _random_state << 17;
+
+        std::uint64_t   bits{_random_state};
+        unsigned        level{1};
+
+        while ((bits & 3) == 0 && level < max_level)
+        {
+            ++level;
+            bits >>= 2;
+        }
+
+        return level;
+    }
+
+    // Find, on each level in use, the last link before the given index, and
+    // the rank of the node it belongs to.
+    void find_predecessors(size_t index, link_t **update, size_t *rank) noexcept
+    {
+        link_t *links{_head};
+        size_t  position{0};
+
+        for (unsigned level = _level; level-- > 0; )
+        {
+            while (links[level].next != nullptr && position + links[level].width <= index)
+            {
+                position += links[level].width;
+                links = links[level].next->links();
+            }
+
+            update[level] = &links[level];
+            rank[level] = position;
+        }
+    }
+
+    // Obtain a node and room for its links from the allocator, and construct
+    // them with the given data.
+    node_t *create_node(const T &data, unsigned level)
+    {
+        node_t *node{node_traits::allocate(_allocator, node_units(level))};
+
+        try
+        {
+            node_traits::construct(_allocator, node, data, level);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, node, node_units(level));
+            throw;
+        }
+
+        for (unsigned i = 0; i < level; ++i)
+            ::new (static_cast<void *>(node->links() + i)) link_t{};
+
+        return node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node_t *node)
+    {
+        size_t  units{node_units(node->_level)};
+
+        node_traits::destroy(_allocator, node);
+        node_traits::deallocate(_allocator, node, units);
+    }
+
+// Instance data
+private:
+    node_allocator  _allocator;             ///< Allocator from which nodes are obtained
+    link_t          _head[max_level];       ///< Links from before the first node
+    unsigned        _level{1};              ///< Number of levels in use
+    node_t         *_tail_node{nullptr};    ///< Pointer to the tail node
+    size_t          _count{0};              ///< Number of elements in the linked list
+    std::uint64_t   _random_state{88172645463325252ULL};    ///< Source of node levels
+#if defined(DS_ENABLE_STATS)
+    ListStats   _stats;                     ///< Instrumentation counters
+#endif
+};
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  An IndexedList that allocates its nodes from a
+///         \c std::pmr::memory_resource given to its constructor.
+///
+/// \see    pmr::DoubleLinkedList
+template<typename T>
+using IndexedList = ::IndexedList<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
+#endif // INC_INDEXED_LIST
@@ -0,0 +1,216 @@
+/// \file   ListFile.h
+/// \brief  On-disk format for saving linked lists of trivially-copyable data
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_FILE
+#define INC_LIST_FILE
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/// \brief  Definitions of the linked list file format.
+///
+/// A list file consists of a header followed by one record per list node.
+/// Each record holds the node's data and the links to the next and
+/// previous records. The links are not pointers but signed byte offsets
+/// from the start of the record holding them, with zero meaning "none", so
+/// a file can be mapped into memory at any address and traversed in place
+/// without being deserialized.
+///
+/// The file stores data in the native byte order and layout of the machine
+/// that wrote it; it is intended to be reloaded on the same platform. Only
+/// the sizes of the data and records are checked when a file is opened, so
+/// the reader is responsible for requesting the type that was saved. The
+/// links, however, are checked in full, so that a corrupt or truncated file
+/// cannot lead a traversal outside the file.
+namespace list_file
+{
+
+/// \brief  The header at the beginning of every list file.
+struct header
+{
+    char          magic[8];         ///< Identifies the file as a list file
+    std::uint32_t version;          ///< Version of the file format
+    std::uint32_t flags;            ///< Reserved, zero
+    std::uint64_t element_size;     ///< Size of the stored data type
+    std::uint64_t record_size;      ///< Size of each node record
+    std::uint64_t count;            ///< Number of node records
+    std::uint64_t head;             ///< File offset of the head record, or zero
+    std::uint64_t tail;             ///< File offset of the tail record, or zero
+};
+
+constexpr char           magic[8]{'D', 'S', 'L', 'I', 'S', 'T', '\0', '\x1a'};
+constexpr std::uint32_t  version{1};
+
+/// \brief  A node record as stored in a list file.
+template<typename T>
+class record
+{
+public:
+    /// \brief  Return a reference to the record's data.
+    const T &data() const noexcept
+    {
+        return _data;
+    }
+
+    /// \brief  Return a pointer to the next record, or \c nullptr.
+    const record *next() const noexcept
+    {
+        return follow(_next);
+    }
+
+    /// \brief  Return a pointer to the previous record, or \c nullptr.
+    const record *prev() const noexcept
+    {
+        return follow(_prev);
+    }
+
+private:
+    const record *follow(std::int64_t offset) const noexcept
+    {
+        return offset == 0
+            ? nullptr
+            : reinterpret_cast<const record *>(reinterpret_cast<const char *>(this) + offset);
+    }
+
+    template<typename U, typename Node>
+    friend bool save(const char *path, Node *head, std::size_t count);
+
+    template<typename U>
+    friend bool links_valid(const char *base, std::uint64_t length);
+
+    T               _data;  // Data contained in the node
+    std::int64_t    _next;  // Offset from this record to the next record
+    std::int64_t    _prev;  // Offset from this record to the previous record
+};
+
+/// \brief  Return the file offset of the first node record.
+template<typename T>
+constexpr std::uint64_t records_offset() noexcept
+{
+    return (sizeof(header) + alignof(record<T>) - 1) / alignof(record<T>) * alignof(record<T>);
+}
+
+/// \brief  Check that the links of a list file, mapped at the given
+///         address, join its records into one list.
+///
+/// \param base     Address of the start of the file.
+/// \param length   Length of the file, which must hold at least a header
+///                 and the number of records the header gives.
+///
+/// \return \c true if the list starts at the head record, links exactly
+///         the header's count of records in both directions, each inside
+///         the file on a record boundary, and ends at the tail record;
+///         \c false otherwise.
+template<typename T>
+bool links_valid(const char *base, std::uint64_t length)
+{
+    using record_t = record<T>;
+
+    const header        &hdr{*reinterpret_cast<const header *>(base)};
+    const std::uint64_t first{records_offset<T>()};
+    const std::uint64_t end{first + hdr.count * sizeof(record_t)};
+
+    if (end > length)
+        return false;
+
+    // Offsets are added as unsigned values, so a link pointing before the
+    // records wraps around to a large offset and fails the range check.
+    std::uint64_t   position{hdr.head};
+    std::uint64_t   previous{0};
+
+    for (std::uint64_t n{0}; n < hdr.count; ++n)
+    {
+        if (position < first || position >= end || (position - first) % sizeof(record_t) != 0)
+            return false;
+
+        const record_t &rec{*reinterpret_cast<const record_t *>(base + position)};
+
+        if ((rec._prev == 0 ? 0 : position + static_cast<std::uint64_t>(rec._prev)) != previous)
+            return false;
+
+        previous = position;
+        position = rec._next == 0 ? 0 : position + static_cast<std::uint64_t>(rec._next);
+    }
+
+    return position == 0 && previous == hdr.tail;
+}
+
+/// \brief  Write a linked list to a file.
+///
+/// \param path     Name of the file to be written.
+/// \param head     Pointer to the head node of the list.
+/// \param count    Number of nodes in the list.
+///
+/// \return \c true if the file was written successfully, \c false otherwise.
+///
+/// The records are written in list order through a fixed-size buffer, so
+/// the file is produced with a small number of large writes.
+template<typename T, typename Node>
+bool save(const char *path, Node *head, std::size_t count)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only lists of trivially copyable types can be saved");
+
+    using record_t = record<T>;
+    constexpr std::size_t   buffer_records{4096};
+    constexpr std::int64_t  stride{sizeof(record_t)};
+    const std::uint64_t     first{records_offset<T>()};
+
+    std::FILE *file{std::fopen(path, "wb")};
+
+    if (file == nullptr)
+        return false;
+
+    header  hdr;
+
+    std::memcpy(hdr.magic, magic, sizeof(hdr.magic));
+    hdr.version = version;
+    hdr.flags = 0;
+    hdr.element_size = sizeof(T);
+    hdr.record_size = sizeof(record_t);
+    hdr.count = count;
+    hdr.head = count == 0 ? 0 : first;
+    hdr.tail = count == 0 ? 0 : first + (count - 1) * sizeof(record_t);
+
+    bool ok{std::fwrite(&hdr, sizeof(hdr), 1, file) == 1};
+
+    for (std::uint64_t pad{sizeof(hdr)}; ok && pad < first; ++pad)
+        ok = std::fputc(0, file) != EOF;
+
+    // Records are written in list order, so each record's neighbours are the
+    // records immediately before and after it in the file.
+    std::vector<record_t>   buffer(buffer_records);
+    std::size_t             written{0};
+
+    while (ok && head != nullptr)
+    {
+        std::size_t used{0};
+
+        for (; used < buffer_records && head != nullptr; ++used, ++written)
+        {
+            record_t &rec{buffer[used]};
+
+            std::memcpy(static_cast<void *>(&rec._data), &head->data(), sizeof(T));
+            rec._prev = written == 0 ? 0 : -stride;
+            rec._next = written + 1 == count ? 0 : stride;
+
+            head = head->next();
+        }
+
+        ok = std::fwrite(buffer.data(), sizeof(record_t), used, file) == used;
+    }
+
+    ok = ok && written == count;
+
+    return std::fclose(file) == 0 && ok;
+}
+
+} // namespace list_file
+
+#endif // INC_LIST_FILE
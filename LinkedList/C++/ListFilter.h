@@ -0,0 +1,223 @@
+/// \file   ListFilter.h
+/// \brief  A counting Bloom filter that lets a list reject lookups of
+///         values it does not hold without walking it
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_FILTER
+#define INC_LIST_FILTER
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/// \brief  The effectiveness and cost of a list's membership filter.
+struct FilterStats
+{
+    size_t          memory_bytes{0};    ///< Bytes held by the filter's counters
+    size_t          counter_count{0};   ///< Number of counters in the filter
+    unsigned        hash_count{0};      ///< Counters examined per value
+    std::uint64_t   queries{0};         ///< Lookups that consulted the filter
+    std::uint64_t   rejected{0};        ///< Lookups answered without a walk
+    std::uint64_t   false_positives{0}; ///< Lookups that walked the list in vain
+
+    /// \brief  Return the proportion of lookups of absent values that the
+    ///         filter failed to reject, or 0 if there have been none.
+    double false_positive_rate() const noexcept
+    {
+        std::uint64_t   misses{rejected + false_positives};
+
+        return misses == 0 ? 0.0 : double(false_positives) / double(misses);
+    }
+};
+
+/// \brief  A counting Bloom filter over values of type \c T.
+///
+/// \tparam T   The type of the values held by the filter.
+///
+/// Each value is hashed to \c hash_count of the filter's counters, and
+/// adding it increments them. A value whose counters include a zero was
+/// never added, so \c may_contain answers \c false for it with certainty;
+/// if all of them are non-zero the value may or may not be present. Unlike
+/// a plain Bloom filter, the counters let a value be removed again.
+///
+/// The counters are four bits wide, two to a byte. A counter that reaches
+/// its maximum sticks there and is never decremented, so the filter can only
+/// err towards answering \c true.
+///
+/// The filter is sized for an expected number of values and a false positive
+/// rate. Holding more values than expected raises the rate.
+template<typename T>
+class CountingBloomFilter
+{
+public:
+    /// \brief  The type of the function from which a value's counters are
+    ///         derived.
+    using hash_function = std::size_t (*)(const T &);
+
+    /// \brief  Construct an empty filter.
+    ///
+    /// \param expected_size        The number of values the filter is sized
+    ///                             for.
+    /// \param false_positive_rate  The proportion of absent values that may be
+    ///                             reported as present when \p expected_size
+    ///                             values are held; between 0 and 1.
+    /// \param hash                 The hash function for the values.
+    ///
+    /// \throw std::invalid_argument if \p false_positive_rate is not strictly
+    ///        between 0 and 1.
+    CountingBloomFilter(size_t expected_size, double false_positive_rate, hash_function hash)
+      : _hash{hash}
+    {
+        if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+            throw std::invalid_argument("CountingBloomFilter: false positive rate must be between 0 and 1");
+
+        // The optimal sizes are m = -n ln p / (ln 2)^2 counters and
+        // k = (m / n) ln 2 hashes.
+        const double    ln2{std::log(2.0)};
+        const double    n{double(std::max<size_t>(expected_size, 1))};
+        const double    m{std::ceil(-n * std::log(false_positive_rate) / (ln2 * ln2))};
+
+        _counter_count = std::max<size_t>(size_t(m), 2);
+        _hash_count = unsigned(std::max(1.0, std::round(m / n * ln2)));
+        _counters.assign((_counter_count + 1) / 2, 0);
+    }
+
+    /// \brief  Add a value to the filter.
+    void insert(const T &value) noexcept
+    {
+        probe(value, [this](size_t index)
+            {
+                unsigned    count{counter(index)};
+
+                if (count < counter_max)
+                    set_counter(index, count + 1);
+                return true;
+            });
+    }
+
+    /// \brief  Remove a value previously added to the filter.
+    void remove(const T &value) noexcept
+    {
+        probe(value, [this](size_t index)
+            {
+                unsigned    count{counter(index)};
+
+                if (count > 0 && count < counter_max)
+                    set_counter(index, count - 1);
+                return true;
+            });
+    }
+
+    /// \brief  Determine whether a value may have been added to the filter.
+    ///
+    /// \return \c false if the value is certainly absent, \c true if it may
+    ///         be present.
+    bool may_contain(const T &value) noexcept
+    {
+        bool    present{probe(value, [this](size_t index)
+                    {
+                        return counter(index) != 0;
+                    })};
+
+        ++_queries;
+        if (!present)
+            ++_rejected;
+
+        return present;
+    }
+
+    /// \brief  Record that a value reported as possibly present was not.
+    void record_false_positive() noexcept
+    {
+        ++_false_positives;
+    }
+
+    /// \brief  Remove every value from the filter. The counts of lookups
+    ///         are kept.
+    void clear() noexcept
+    {
+        std::fill(_counters.begin(), _counters.end(), std::uint8_t{0});
+    }
+
+    /// \brief  Return the filter's size and the counts of its lookups.
+    FilterStats stats() const noexcept
+    {
+        FilterStats stats;
+
+        stats.memory_bytes = _counters.size() * sizeof(std::uint8_t);
+        stats.counter_count = _counter_count;
+        stats.hash_count = _hash_count;
+        stats.queries = _queries;
+        stats.rejected = _rejected;
+        stats.false_positives = _false_positives;
+
+        return stats;
+    }
+
+    /// \brief  Reset the counts of lookups.
+    void reset_stats() noexcept
+    {
+        _queries = _rejected = _false_positives = 0;
+    }
+
+private:
+    static constexpr unsigned counter_max{15};
+
+    // Derive the value's counters from two hashes, as h1 + i * h2, and call
+    // action with the index of each until it returns false. Returns whether
+    // every call returned true.
+    template<typename Action>
+    bool probe(const T &value, Action action) const noexcept
+    {
+        std::uint64_t   h1{mix(std::uint64_t(_hash(value)))};
+        std::uint64_t   h2{mix(h1) | 1};
+
+        for (unsigned i = 0; i < _hash_count; ++i)
+        {
+            if (!action(size_t((h1 + i * h2) % _counter_count)))
+                return false;
+        }
+
+        return true;
+    }
+
+    // Spread the bits of a hash, since std::hash is often the identity.
+    static std::uint64_t mix(std::uint64_t x) noexcept
+    {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    unsigned counter(size_t index) const noexcept
+    {
+        return (_counters[index / 2] >> (index % 2 * 4)) & 0x0f;
+    }
+
+    void set_counter(size_t index, unsigned count) noexcept
+    {
+        unsigned    shift{unsigned(index % 2 * 4)};
+
+        _counters[index / 2] = std::uint8_t((_counters[index / 2] & ~(0x0f << shift))
+                                            | (count << shift));
+    }
+
+// Instance data
+private:
+    std::vector<std::uint8_t>   _counters;          ///< Four-bit counters, two per byte
+    size_t                      _counter_count{0};  ///< Number of counters
+    unsigned                    _hash_count{0};     ///< Counters per value
+    hash_function               _hash;              ///< Hash function for the values
+    std::uint64_t               _queries{0};        ///< Lookups made
+    std::uint64_t               _rejected{0};       ///< Lookups answered false
+    std::uint64_t               _false_positives{0};///< Lookups wrongly answered true
+};
+
+#endif // INC_LIST_FILTER
@@ -0,0 +1,54 @@
+/// \file   ListOrganize.h
+/// \brief  Self-organizing search policies for linked lists
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_ORGANIZE
+#define INC_LIST_ORGANIZE
+
+/// \brief  Tag type selecting a search that moves the node found to the
+///         head of the list, as in \c list.find(value, move_to_front).
+///
+/// A value that is looked up again soon is then found at once. The order
+/// adapts quickly when the popular values change, but a single lookup of a
+/// rare value pushes every popular one a place further back.
+struct move_to_front_t
+{
+    explicit constexpr move_to_front_t() = default;
+};
+
+/// \brief  Tag value selecting the move-to-front search.
+static constexpr move_to_front_t move_to_front{};
+
+/// \brief  Tag type selecting a search that exchanges the node found with
+///         the node before it, as in \c list.find(value, transpose).
+///
+/// Popular values creep towards the head one place per lookup, so the order
+/// settles more slowly than with move-to-front but is hardly disturbed by a
+/// lookup of a rare value.
+struct transpose_t
+{
+    explicit constexpr transpose_t() = default;
+};
+
+/// \brief  Tag value selecting the transposing search.
+static constexpr transpose_t transpose{};
+
+/// \brief  Tag type selecting a search that counts the lookups of each node
+///         and keeps the nodes in decreasing order of their counts, as in
+///         \c list.find(value, frequency_count).
+///
+/// The order approaches the best static order for the lookups made so far,
+/// at the cost of some extra traversal whenever a node overtakes the nodes
+/// before it. The counts are kept in a table beside the list, created by
+/// the first such search, so nodes are no larger in lists that never use
+/// it. Nodes added to the list start with a count of zero.
+struct frequency_count_t
+{
+    explicit constexpr frequency_count_t() = default;
+};
+
+/// \brief  Tag value selecting the frequency-count search.
+static constexpr frequency_count_t frequency_count{};
+
+#endif // INC_LIST_ORGANIZE
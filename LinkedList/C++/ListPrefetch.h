@@ -0,0 +1,36 @@
+/// \file   ListPrefetch.h
+/// \brief  Software prefetching for linked list traversal
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_PREFETCH
+#define INC_LIST_PREFETCH
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  include <xmmintrin.h>
+#endif
+
+/// \brief  Ask the processor to begin loading the cache line holding the
+///         given address, without waiting for it.
+///
+/// Prefetching an address that is not mapped does not fault. On compilers
+/// without a prefetch intrinsic this expands to nothing.
+#if defined(__GNUC__) || defined(__clang__)
+#  define DS_PREFETCH(address)  __builtin_prefetch(address)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#  define DS_PREFETCH(address)  _mm_prefetch(reinterpret_cast<const char *>(address), _MM_HINT_T0)
+#else
+#  define DS_PREFETCH(address)  ((void)(address))
+#endif
+
+/// \brief  Tag type selecting the prefetching variant of a traversal, as in
+///         \c list.find(value, prefetch_traversal).
+struct prefetch_traversal_t
+{
+    explicit constexpr prefetch_traversal_t() = default;
+};
+
+/// \brief  Tag value selecting the prefetching variant of a traversal.
+static constexpr prefetch_traversal_t prefetch_traversal{};
+
+#endif // INC_LIST_PREFETCH
@@ -0,0 +1,281 @@
+/// \file   ListSegments.h
+/// \brief  Parallel traversal of linked lists divided into segments
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_SEGMENTS
+#define INC_LIST_SEGMENTS
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// \brief  A table of skip pointers dividing a linked list into segments of
+///         nearly equal length, so that the segments can be traversed by
+///         several threads at once.
+///
+/// A linked list can only be walked from one node to the next, so without
+/// help a second thread has nowhere to start. Building the table walks the
+/// list once, recording the first node of each segment; after that,
+/// \c for_each, \c find_if and \c reduce hand the segments out to a set of
+/// worker threads. The table can be reused for any number of traversals,
+/// but must be rebuilt once nodes are added to or removed from the list.
+///
+/// Works with any list whose \c head member function returns a pointer to
+/// nodes with \c next and \c data member functions, including
+/// SingleLinkedList, DoubleLinkedList and MappedList.
+///
+/// Worker threads are started for each traversal and joined before it
+/// returns. They take segments from a shared counter, so a thread that
+/// finishes early moves on to the next unclaimed segment. More segments than
+/// threads therefore balances the load better, at the cost of a larger table.
+template<typename List>
+class ListSegments
+{
+public:
+    /// \brief  The type of a pointer to the list's nodes.
+    using node_pointer = decltype(std::declval<const List &>().head());
+
+    /// \brief  Construct a table dividing the list into the given number of
+    ///         segments, or fewer if the list is shorter.
+    ListSegments(const List &list, size_t segment_count)
+    {
+        rebuild(list, segment_count);
+    }
+
+    /// \brief  Rebuild the table after the list has been modified.
+    void rebuild(const List &list, size_t segment_count)
+    {
+        const size_t    count{list.size()};
+
+        _starts.clear();
+        _lengths.clear();
+        if (count == 0 || segment_count == 0)
+            return;
+
+        segment_count = std::min(segment_count, count);
+        _starts.reserve(segment_count);
+        _lengths.reserve(segment_count);
+
+        node_pointer    node{list.head()};
+
+        for (size_t i{0}; i < segment_count; ++i)
+        {
+            // Spread the remainder over the first segments.
+            size_t  length{count / segment_count + (i < count % segment_count ? 1 : 0)};
+
+            _starts.push_back(node);
+            _lengths.push_back(length);
+            while (length-- > 0)
+                node = node->next();
+        }
+    }
+
+    /// \brief  Return the number of segments.
+    size_t size() const noexcept
+    {
+        return _starts.size();
+    }
+
+    /// \brief  Return the first node of a segment.
+    node_pointer start(size_t segment) const noexcept
+    {
+        return _starts[segment];
+    }
+
+    /// \brief  Return the number of nodes in a segment.
+    size_t length(size_t segment) const noexcept
+    {
+        return _lengths[segment];
+    }
+
+    /// \brief  Call a function with the data of every node, using the given
+    ///         number of threads.
+    ///
+    /// \param func     Function called as \c func(data). Calls made for
+    ///                 different nodes may run at the same time.
+    /// \param threads  The number of threads to use.
+    template<typename Function>
+    void for_each(Function func, unsigned threads) const
+    {
+        run(threads, [&](size_t segment)
+            {
+                node_pointer node{_starts[segment]};
+
+                for (size_t n{_lengths[segment]}; n > 0; --n, node = node->next())
+                    func(node->data());
+            });
+    }
+
+    /// \brief  Locate the first node, in list order, whose data satisfies a
+    ///         predicate, using the given number of threads.
+    ///
+    /// \param pred     Predicate called as \c pred(data). Calls made for
+    ///                 different nodes may run at the same time.
+    /// \param threads  The number of threads to use.
+    ///
+    /// \return A pointer to the first matching node, or \c nullptr if there
+    ///         is none.
+    ///
+    /// Once a match has been found, segments following it in the list are
+    /// abandoned, so a match near the head of the list ends the search early.
+    /// Segments preceding it are still searched, since one of them may hold
+    /// an earlier match.
+    template<typename Predicate>
+    node_pointer find_if(Predicate pred, unsigned threads) const
+    {
+        constexpr size_t        none{std::numeric_limits<size_t>::max()};
+        std::atomic<size_t>     found_segment{none};
+        std::vector<node_pointer>   found(_starts.size(), nullptr);
+
+        run(threads, [&](size_t segment)
+            {
+                node_pointer node{_starts[segment]};
+
+                for (size_t n{_lengths[segment]}; n > 0; --n, node = node->next())
+                {
+                    // Give up if an earlier segment already holds a match.
+                    if ((n & check_interval_mask) == 0
+                        && found_segment.load(std::memory_order_relaxed) < segment)
+                        return;
+
+                    if (pred(node->data()))
+                    {
+                        found[segment] = node;
+
+                        size_t  current{found_segment.load(std::memory_order_relaxed)};
+                        while (segment < current
+                               && !found_segment.compare_exchange_weak(current, segment))
+                            ;
+                        return;
+                    }
+                }
+            },
+            [&](size_t segment)
+            {
+                return found_segment.load(std::memory_order_relaxed) < segment;
+            });
+
+        size_t  segment{found_segment.load()};
+        return segment == none ? nullptr : found[segment];
+    }
+
+    /// \brief  Fold the data of every node into a result, using the given
+    ///         number of threads.
+    ///
+    /// \param identity The starting value of each segment's partial result
+    ///                 and of the combined result. It must leave any result
+    ///                 unchanged when combined with it.
+    /// \param op       The operation called as \c op(result, data) to fold
+    ///                 each node's data, the first included, into the
+    ///                 partial result of its segment.
+    /// \param combine  An associative operation called as
+    ///                 \c combine(result, result) to join the partial
+    ///                 results. They are joined in list order, so it need
+    ///                 not be commutative.
+    /// \param threads  The number of threads to use.
+    ///
+    /// \return The partial results joined in list order. For a sum of
+    ///         squares, for example, \p op adds the square of the data and
+    ///         \p combine adds two partial sums.
+    template<typename Result, typename Operation, typename Combine>
+    Result reduce(Result identity, Operation op, Combine combine, unsigned threads) const
+    {
+        // Each segment's result is given a cache line of its own, so that
+        // the threads storing them neither share a line nor, as they would
+        // in a std::vector<bool>, a word.
+        struct alignas(64) partial_t
+        {
+            Result  value;
+        };
+
+        std::vector<partial_t>  partial(_starts.size(), partial_t{identity});
+
+        run(threads, [&](size_t segment)
+            {
+                node_pointer    node{_starts[segment]};
+                Result          value(identity);
+
+                for (size_t n{_lengths[segment]}; n > 0; --n, node = node->next())
+                    value = op(value, node->data());
+
+                partial[segment].value = std::move(value);
+            });
+
+        for (auto &result : partial)
+            identity = combine(identity, result.value);
+
+        return identity;
+    }
+
+private:
+    // Number of nodes between checks for cancellation, less one.
+    static constexpr size_t check_interval_mask{63};
+
+    // Process every segment with the given number of threads.
+    template<typename Work>
+    void run(unsigned threads, Work work) const
+    {
+        run(threads, work, [](size_t) { return false; });
+    }
+
+    // Process every segment with the given number of threads, skipping any
+    // segment for which skip returns true. The first exception thrown by a
+    // worker is rethrown once all of the workers have finished.
+    template<typename Work, typename Skip>
+    void run(unsigned threads, Work work, Skip skip) const
+    {
+        std::atomic<size_t> next_segment{0};
+        std::exception_ptr  error;
+        std::mutex          error_mutex;
+
+        auto worker = [&]()
+        {
+            for (size_t segment{next_segment++}; segment < _starts.size(); segment = next_segment++)
+            {
+                if (skip(segment))
+                    continue;
+
+                try
+                {
+                    work(segment);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (!error)
+                        error = std::current_exception();
+                    next_segment = _starts.size();
+                }
+            }
+        };
+
+        threads = std::max(1u, std::min<unsigned>(threads, static_cast<unsigned>(_starts.size())));
+
+        std::vector<std::thread>    pool;
+        pool.reserve(threads - 1);
+        for (unsigned i{1}; i < threads; ++i)
+            pool.emplace_back(worker);
+
+        // The calling thread does its share of the work.
+        worker();
+        for (auto &thread : pool)
+            thread.join();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+// Instance data
+private:
+    std::vector<node_pointer>   _starts;    ///< First node of each segment
+    std::vector<size_t>         _lengths;   ///< Number of nodes in each segment
+};
+
+#endif // INC_LIST_SEGMENTS
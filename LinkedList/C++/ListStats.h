@@ -0,0 +1,125 @@
+/// \file   ListStats.h
+/// \brief  Optional instrumentation counters for the C++ linked lists
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_STATS
+#define INC_LIST_STATS
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/// \brief  Statements passed to this macro are compiled only when the
+///         instrumentation counters are enabled by defining DS_ENABLE_STATS.
+///
+/// When DS_ENABLE_STATS is not defined the counters are never updated and
+/// the lists carry no additional data, so the instrumentation costs nothing.
+#if defined(DS_ENABLE_STATS)
+#  define DS_LIST_STATS(...)    __VA_ARGS__
+#else
+#  define DS_LIST_STATS(...)
+#endif
+
+/// \brief  Counters describing the activity of a linked list.
+///
+/// A list keeps these counters only when DS_ENABLE_STATS is defined;
+/// otherwise its \c stats member function reports all zeros.
+struct ListStats
+{
+    std::uint64_t   allocations{0};         ///< Number of nodes allocated
+    std::uint64_t   deallocations{0};       ///< Number of nodes freed
+    std::uint64_t   bytes_allocated{0};     ///< Total bytes allocated for nodes
+    std::uint64_t   peak_size{0};           ///< Largest number of elements held
+    std::uint64_t   finds{0};               ///< Number of calls to find
+    std::uint64_t   find_probes{0};         ///< Nodes examined by all finds
+    std::uint64_t   max_find_probes{0};     ///< Most nodes examined by one find
+    std::uint64_t   remove_scans{0};        ///< Removals that searched for a predecessor
+    std::uint64_t   remove_scan_probes{0};  ///< Nodes examined by all those searches
+    std::uint64_t   max_remove_scan{0};     ///< Most nodes examined by one search
+
+    /// \brief  Return the average number of nodes examined by a find.
+    double average_find_probes() const noexcept
+    {
+        return finds == 0 ? 0.0 : static_cast<double>(find_probes) / finds;
+    }
+
+    /// \brief  Return the average number of nodes examined when searching
+    ///         for the predecessor of a removed node.
+    double average_remove_scan() const noexcept
+    {
+        return remove_scans == 0 ? 0.0 : static_cast<double>(remove_scan_probes) / remove_scans;
+    }
+
+    /// \brief  Record the allocation of nodes of the given size.
+    void record_allocation(std::size_t bytes, std::uint64_t count = 1) noexcept
+    {
+        allocations += count;
+        bytes_allocated += bytes * count;
+    }
+
+    /// \brief  Record the freeing of nodes.
+    void record_deallocation(std::uint64_t count = 1) noexcept
+    {
+        deallocations += count;
+    }
+
+    /// \brief  Record the current number of elements.
+    void record_size(std::uint64_t size) noexcept
+    {
+        if (size > peak_size)
+            peak_size = size;
+    }
+
+    /// \brief  Record a find that examined the given number of nodes.
+    void record_find(std::uint64_t probes) noexcept
+    {
+        ++finds;
+        find_probes += probes;
+        if (probes > max_find_probes)
+            max_find_probes = probes;
+    }
+
+    /// \brief  Record a predecessor search that examined the given number
+    ///         of nodes.
+    void record_remove_scan(std::uint64_t probes) noexcept
+    {
+        ++remove_scans;
+        remove_scan_probes += probes;
+        if (probes > max_remove_scan)
+            max_remove_scan = probes;
+    }
+
+    /// \brief  Write the counters as human-readable text, one per line.
+    void write_text(std::ostream &out) const
+    {
+        out << "allocations:          " << allocations << '\n'
+            << "deallocations:        " << deallocations << '\n'
+            << "bytes allocated:      " << bytes_allocated << '\n'
+            << "peak size:            " << peak_size << '\n'
+            << "finds:                " << finds << '\n'
+            << "average find probes:  " << average_find_probes() << '\n'
+            << "maximum find probes:  " << max_find_probes << '\n'
+            << "remove scans:         " << remove_scans << '\n'
+            << "average remove scan:  " << average_remove_scan() << '\n'
+            << "maximum remove scan:  " << max_remove_scan << '\n';
+    }
+
+    /// \brief  Write the counters as a JSON object.
+    void write_json(std::ostream &out) const
+    {
+        out << "{\"allocations\":" << allocations
+            << ",\"deallocations\":" << deallocations
+            << ",\"bytes_allocated\":" << bytes_allocated
+            << ",\"peak_size\":" << peak_size
+            << ",\"finds\":" << finds
+            << ",\"average_find_probes\":" << average_find_probes()
+            << ",\"max_find_probes\":" << max_find_probes
+            << ",\"remove_scans\":" << remove_scans
+            << ",\"average_remove_scan\":" << average_remove_scan()
+            << ",\"max_remove_scan\":" << max_remove_scan
+            << '}';
+    }
+};
+
+#endif // INC_LIST_STATS
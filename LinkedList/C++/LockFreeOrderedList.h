@@ -0,0 +1,342 @@
+/// \file   LockFreeOrderedList.h
+/// \brief  A lock-free sorted singly-linked list used as a concurrent set
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LOCK_FREE_ORDERED_LIST
+#define INC_LOCK_FREE_ORDERED_LIST
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "EpochReclamation.h"
+
+/// \brief  A set kept as a sorted singly-linked list, which any number of
+///         threads may search and change at once without locks.
+///
+/// \tparam T           The type of the elements held by the set.
+/// \tparam Compare     The ordering of the elements.
+/// \tparam Allocator   The allocator from which the list's nodes are
+///                     obtained. It is rebound to the node type, and must be
+///                     safe to use from several threads at once.
+///
+/// This is the list of Harris, as refined by Michael. A node is removed in
+/// two steps: first the low bit of its \c next pointer is set, marking it
+/// deleted so that no node can be linked after it, and then it is unlinked
+/// from its predecessor. Any thread finding a marked node during a search
+/// helps by unlinking it, so a remove never waits for the thread that began
+/// it. Every change is a single compare-and-swap of one pointer.
+///
+/// Unlinked nodes are passed to an EpochDomain, shared by default with every
+/// other lock-free structure, which frees them once no thread can still be
+/// reading them. Each operation holds an EpochDomain::guard while it runs.
+template<typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+class LockFreeOrderedList
+{
+public:
+    /// \brief  The type of the allocator used by the list.
+    using allocator_type = Allocator;
+
+    /// \brief  Construct an empty set, whose removed nodes are reclaimed
+    ///         through the given domain.
+    explicit LockFreeOrderedList(EpochDomain &domain = EpochDomain::shared(),
+                                 const Allocator &allocator = Allocator())
+      : _allocator(allocator),
+        _domain{domain}
+    {
+    }
+
+    LockFreeOrderedList(const LockFreeOrderedList &) = delete;
+    LockFreeOrderedList & operator=(const LockFreeOrderedList &) = delete;
+
+    /// \brief  Destroy the set and reclaim its nodes. No other thread may be
+    ///         using the set.
+    ~LockFreeOrderedList()
+    {
+        std::uintptr_t  current{_head.next.load()};
+
+        while (pointer(current) != nullptr)
+        {
+            node_t         *node{pointer(current)};
+
+            current = node->next.load();
+            destroy_node(node);
+        }
+
+        _domain.drain(this);
+    }
+
+    /// \brief  Return the number of elements in the set. If other threads
+    ///         are changing the set, the result may already be out of date.
+    size_t size() const noexcept
+    {
+        return _count.load(std::memory_order_relaxed);
+    }
+
+    /// \brief  Determine if the set is empty. If other threads are changing
+    ///         the set, the result may already be out of date.
+    bool is_empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /// \brief  Add an element to the set.
+    ///
+    /// \return \c true if the element was added, or \c false if an equal
+    ///         element was already present.
+    bool insert(const T &data)
+    {
+        EpochDomain::guard  guard(_domain);
+        node_t             *new_node{nullptr};
+
+        for (;;)
+        {
+            position    at{search(data)};
+
+            if (at.found)
+            {
+                // The node was never visible to another thread.
+                if (new_node != nullptr)
+                {
+                    destroy_node(new_node);
+                    --_count;
+                }
+                return false;
+            }
+
+            // The node is counted before it is published, so that a thread
+            // removing it at once cannot take the count below zero.
+            if (new_node == nullptr)
+            {
+                new_node = create_node(data);
+                ++_count;
+            }
+            new_node->next.store(address(at.current), std::memory_order_relaxed);
+
+            std::uintptr_t  expected{address(at.current)};
+
+            if (at.previous->next.compare_exchange_strong(expected, address(new_node),
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed))
+                return true;
+        }
+    }
+
+    /// \brief  Remove an element from the set.
+    ///
+    /// \return \c true if the element was removed, or \c false if it was not
+    ///         present.
+    bool remove(const T &data)
+    {
+        EpochDomain::guard  guard(_domain);
+
+        for (;;)
+        {
+            position    at{search(data)};
+
+            if (!at.found)
+                return false;
+
+            // Mark the node deleted. Whoever succeeds has removed it.
+            std::uintptr_t  next{at.current->next.load(std::memory_order_acquire)};
+
+            if (is_marked(next)
+                || !at.current->next.compare_exchange_strong(next, next | mark_bit,
+                                                             std::memory_order_acq_rel,
+                                                             std::memory_order_relaxed))
+                continue;
+
+            --_count;
+
+            // Try to unlink it; if that fails, a search will do so instead.
+            std::uintptr_t  expected{address(at.current)};
+
+            if (at.previous->next.compare_exchange_strong(expected, next,
+                                                          std::memory_order_acq_rel,
+                                                          std::memory_order_relaxed))
+                retire(at.current);
+            else
+                search(data);
+
+            return true;
+        }
+    }
+
+    /// \brief  Determine whether the set holds an element. This never writes
+    ///         to the list, so it does not slow down other threads.
+    bool contains(const T &data) const
+    {
+        EpochDomain::guard  guard(_domain);
+        node_t             *current{pointer(_head.next.load(std::memory_order_acquire))};
+
+        while (current != nullptr && _less(current->data, data))
+            current = pointer(current->next.load(std::memory_order_acquire));
+
+        return current != nullptr && !_less(data, current->data)
+               && !is_marked(current->next.load(std::memory_order_acquire));
+    }
+
+    /// \brief  Call a function with every element of the set, in order.
+    ///         Elements added or removed during the call may or may not be
+    ///         visited.
+    template<typename Function>
+    void for_each(Function func) const
+    {
+        EpochDomain::guard  guard(_domain);
+        node_t             *current{pointer(_head.next.load(std::memory_order_acquire))};
+
+        while (current != nullptr)
+        {
+            std::uintptr_t  next{current->next.load(std::memory_order_acquire)};
+
+            if (!is_marked(next))
+                func(static_cast<const T &>(current->data));
+            current = pointer(next);
+        }
+    }
+
+    /// \brief  Return a copy of the allocator used by the list.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+private:
+    // The low bit of a next pointer marks its node as deleted.
+    static constexpr std::uintptr_t mark_bit{1};
+
+    // The link of a node. The head of the list holds no data.
+    struct link_t
+    {
+        std::atomic<std::uintptr_t> next{0};
+    };
+
+    struct node_t : link_t
+    {
+        explicit node_t(const T &value)
+          : data{value}
+        {}
+
+        T   data;
+    };
+
+    // Where a value belongs: the first node not ordered before it, and the
+    // link leading to that node.
+    struct position
+    {
+        link_t *previous;
+        node_t *current;
+        bool    found;
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    static node_t *pointer(std::uintptr_t link) noexcept
+    {
+        return reinterpret_cast<node_t *>(link & ~mark_bit);
+    }
+
+    static std::uintptr_t address(node_t *node) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(node);
+    }
+
+    static bool is_marked(std::uintptr_t link) noexcept
+    {
+        return (link & mark_bit) != 0;
+    }
+
+    // Find where a value belongs, unlinking any marked nodes on the way.
+    // Must be called with a guard held.
+    position search(const T &data)
+    {
+        for (;;)
+        {
+            link_t *previous{&_head};
+            node_t *current{pointer(previous->next.load(std::memory_order_acquire))};
+            bool    restart{false};
+
+            while (current != nullptr)
+            {
+                std::uintptr_t  next{current->next.load(std::memory_order_acquire)};
+
+                if (is_marked(next))
+                {
+                    // Fails if the predecessor changed or was itself marked,
+                    // in which case the search starts again from the head.
+                    std::uintptr_t  expected{address(current)};
+
+                    if (!previous->next.compare_exchange_strong(expected, next & ~mark_bit,
+                                                                std::memory_order_acq_rel,
+                                                                std::memory_order_acquire))
+                    {
+                        restart = true;
+                        break;
+                    }
+
+                    retire(current);
+                    current = pointer(next);
+                    continue;
+                }
+
+                if (!_less(current->data, data))
+                    return {previous, current, !_less(data, current->data)};
+
+                previous = current;
+                current = pointer(next);
+            }
+
+            if (!restart)
+                return {previous, nullptr, false};
+        }
+    }
+
+    void retire(node_t *node)
+    {
+        _domain.retire(node, [](void *object, void *context)
+                             {
+                                 static_cast<LockFreeOrderedList *>(context)
+                                     ->destroy_node(static_cast<node_t *>(object));
+                             },
+                       this);
+    }
+
+    // Obtain a node from the allocator and construct it with the given data.
+    node_t *create_node(const T &data)
+    {
+        node_t *node{node_traits::allocate(_allocator, 1)};
+
+        try
+        {
+            node_traits::construct(_allocator, node, data);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, node, 1);
+            throw;
+        }
+
+        return node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node_t *node)
+    {
+        node_traits::destroy(_allocator, node);
+        node_traits::deallocate(_allocator, node, 1);
+    }
+
+// Instance data
+private:
+    node_allocator      _allocator;     ///< Allocator from which nodes are obtained
+    EpochDomain        &_domain;        ///< Reclaims removed nodes
+    Compare             _less;          ///< Ordering of the elements
+    link_t              _head;          ///< Link to the first node
+    std::atomic<size_t> _count{0};      ///< Number of elements in the set
+};
+
+#endif // INC_LOCK_FREE_ORDERED_LIST
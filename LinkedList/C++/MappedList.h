@@ -0,0 +1,242 @@
+/// \file   MappedList.h
+/// \brief  Read-only, memory-mapped access to a saved linked list
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_MAPPED_LIST
+#define INC_MAPPED_LIST
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include "ListFile.h"
+
+/// \brief  A linked list that has been saved to a file with the \c save
+///         member function of SingleLinkedList or DoubleLinkedList, mapped
+///         read-only into memory.
+///
+/// The file is not deserialized: opening it maps it into the address space
+/// and the nodes are traversed in place, in either direction. Opening the
+/// file walks its links once to check that they stay inside the file, which
+/// pages it in, but no node is copied or allocated.
+template<typename T>
+class MappedList
+{
+public:
+    /// \brief  The type of the list's nodes.
+    using node_t = list_file::record<T>;
+
+    /// \brief  Default-construct a MappedList that has no file open.
+    MappedList() noexcept = default;
+
+    /// \brief  Construct a MappedList and open the specified file.
+    ///
+    /// Use is_open to determine whether the file was opened successfully.
+    explicit MappedList(const char *path)
+    {
+        open(path);
+    }
+
+    MappedList(const MappedList &) = delete;
+    MappedList & operator=(const MappedList &) = delete;
+
+    /// \brief  Destroy a MappedList, unmapping its file.
+    ~MappedList()
+    {
+        close();
+    }
+
+    /// \brief  Map a list file into memory.
+    ///
+    /// \param path Name of the file to be opened.
+    ///
+    /// \return \c true if the file was opened and is a valid list file for
+    ///         type \c T, \c false otherwise.
+    bool open(const char *path)
+    {
+        close();
+
+        if (!map(path))
+            return false;
+
+        if (!validate())
+        {
+            close();
+            return false;
+        }
+
+        return true;
+    }
+
+    /// \brief  Unmap the currently open file, if any.
+    void close() noexcept
+    {
+        if (_base != nullptr)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(_base);
+#else
+            munmap(const_cast<char *>(_base), _length);
+#endif
+        }
+
+        _base = nullptr;
+        _length = 0;
+    }
+
+    /// \brief  Determine if a file is open.
+    bool is_open() const noexcept
+    {
+        return _base != nullptr;
+    }
+
+    /// \brief  Return a pointer to the head node.
+    const node_t *head() const noexcept
+    {
+        return is_open() ? at(header().head) : nullptr;
+    }
+
+    /// \brief  Return a pointer to the tail node.
+    const node_t *tail() const noexcept
+    {
+        return is_open() ? at(header().tail) : nullptr;
+    }
+
+    /// \brief  Return the number of elements in the list.
+    size_t size() const noexcept
+    {
+        return is_open() ? static_cast<size_t>(header().count) : 0;
+    }
+
+    /// \brief  Determine if the list is empty.
+    ///
+    /// \return \c true  if the list is empty or no file is open,
+    ///         \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return head() == nullptr;
+    }
+
+    /// \brief  Locate the first node containing the given value.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// \remark Type \c T must be comparable to another object of type \c T
+    ///         via the equality operator (operator==).
+    const node_t *find(const T &data) const
+    {
+        const node_t *current{head()};
+
+        while (current != nullptr)
+        {
+            if (current->data() == data)
+                break;
+
+            current = current->next();
+        }
+
+        return current;
+    }
+
+private:
+    const list_file::header &header() const noexcept
+    {
+        return *reinterpret_cast<const list_file::header *>(_base);
+    }
+
+    const node_t *at(std::uint64_t offset) const noexcept
+    {
+        return offset == 0 ? nullptr
+                           : reinterpret_cast<const node_t *>(_base + offset);
+    }
+
+    // Map the entire file read-only.
+    bool map(const char *path)
+    {
+#if defined(_WIN32)
+        HANDLE file{CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER   size;
+        HANDLE          mapping{nullptr};
+
+        if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+            mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+            return false;
+
+        void *base{MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)};
+        CloseHandle(mapping);
+        if (base == nullptr)
+            return false;
+
+        _length = static_cast<size_t>(size.QuadPart);
+#else
+        int fd{::open(path, O_RDONLY)};
+        if (fd < 0)
+            return false;
+
+        struct stat st;
+        void *base{MAP_FAILED};
+
+        if (fstat(fd, &st) == 0 && st.st_size > 0)
+            base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED)
+            return false;
+
+        _length = static_cast<size_t>(st.st_size);
+#endif
+        _base = static_cast<const char *>(base);
+
+        return true;
+    }
+
+    // Check that the mapped file is a list file holding records for type T,
+    // linked into a single list.
+    bool validate() const noexcept
+    {
+        if (_length < sizeof(list_file::header))
+            return false;
+
+        const list_file::header &hdr{header()};
+        const std::uint64_t first{list_file::records_offset<T>()};
+
+        if (std::memcmp(hdr.magic, list_file::magic, sizeof(hdr.magic)) != 0
+            || hdr.version != list_file::version
+            || hdr.element_size != sizeof(T)
+            || hdr.record_size != sizeof(node_t))
+            return false;
+
+        if (_length < first || hdr.count > (_length - first) / sizeof(node_t))
+            return false;
+
+        return list_file::links_valid<T>(_base, _length);
+    }
+
+// Instance data
+private:
+    const char *_base{nullptr};     ///< Address at which the file is mapped
+    size_t      _length{0};         ///< Length of the mapped file
+};
+
+#endif // INC_MAPPED_LIST
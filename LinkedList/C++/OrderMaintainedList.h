@@ -0,0 +1,582 @@
+/// \file   OrderMaintainedList.h
+/// \brief  A doubly-linked list that can tell in constant time which of two
+///         nodes comes first
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_ORDER_MAINTAINED_LIST
+#define INC_ORDER_MAINTAINED_LIST
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+
+#include "ListStats.h"
+
+/// \brief  A doubly-linked list whose nodes carry order labels, so that
+///         \c precedes(a, b) is answered in constant time.
+///
+/// \tparam T           The type of the elements held by the list.
+/// \tparam Allocator   The allocator from which the list's nodes are
+///                     obtained. It is rebound to the node type.
+///
+/// This is the two-level order-maintenance structure of Dietz and Sleator,
+/// with the upper level labelled as described by Bender et al. The nodes
+/// are divided into runs of consecutive nodes called groups, of at most
+/// \c group_capacity nodes. Each group has a label, and groups later in the
+/// list have larger labels; each node has a label that orders it within its
+/// group. Comparing two nodes therefore compares two integers.
+///
+/// A new node takes the label midway between its neighbours in its group.
+/// When there is no room, the group's few labels are spread out again. When
+/// a group is full it is split in two, and the new group takes a label
+/// between its neighbours; only when those are adjacent are the labels of a
+/// surrounding range of groups spread out. The range is the smallest one,
+/// aligned on a power of two, that is sparse enough, so that repeated
+/// insertions at one place do not relabel the same groups again and again.
+/// Since a group is split only after many insertions, insertion takes
+/// amortized constant time. Removal never relabels.
+///
+/// The interface follows DoubleLinkedList, with \c precedes added.
+template<typename T, typename Allocator = std::allocator<T>>
+class OrderMaintainedList
+{
+    struct group_t;
+
+public:
+    /// \brief  The most nodes a group holds before it is split.
+    static constexpr size_t group_capacity{64};
+
+    /// \brief  The linked list node structure.
+    ///
+    /// This class is the core of the linked list, holding the list element's
+    /// data, the pointers to the next and previous node in the list, and the
+    /// node's place in the order.
+    class node_t
+    {
+    private:
+        T               _data;              ///< Data contained in the node
+        node_t         *_next{nullptr};     ///< Pointer to the next node
+        node_t         *_prev{nullptr};     ///< Pointer to the previous node
+        group_t        *_group{nullptr};    ///< Group holding the node
+        std::uint64_t   _label{0};          ///< Order of the node within its group
+
+    public:
+        explicit node_t(const T &data)
+          : _data{data}
+        {}
+
+        node_t(const node_t &) = delete;
+        node_t & operator=(const node_t &) = delete;
+
+        /// \brief  Return a reference to the node's data.
+        T &data() noexcept
+        {
+            return _data;
+        }
+
+        /// \brief  Return a pointer to the node's next node.
+        node_t *next() const noexcept
+        {
+            return _next;
+        }
+
+        /// \brief  Return a pointer to the node's previous node.
+        node_t *prev() const noexcept
+        {
+            return _prev;
+        }
+
+        friend OrderMaintainedList;
+    };
+
+    /// \brief  The type of the allocator used by the list.
+    using allocator_type = Allocator;
+
+    /// \brief  Default-construct an empty OrderMaintainedList.
+    OrderMaintainedList() = default;
+
+    /// \brief  Construct an empty OrderMaintainedList whose nodes are
+    ///         obtained from the given allocator.
+    explicit OrderMaintainedList(const Allocator &allocator)
+      : _allocator(allocator),
+        _group_allocator(allocator)
+    {
+    }
+
+    OrderMaintainedList(const OrderMaintainedList &) = delete;
+    OrderMaintainedList & operator=(const OrderMaintainedList &) = delete;
+
+    /// \brief  Destroy a Linked List.
+    ///
+    /// Any contained nodes will be removed and their memory reclaimed.
+    ~OrderMaintainedList()
+    {
+        erase();
+    }
+
+    /// \brief  Return a pointer to the head node
+    node_t *head() const noexcept
+    {
+        return _head_node;
+    }
+
+    /// \brief  Return a pointer to the tail node.
+    node_t *tail() const noexcept
+    {
+        return _tail_node;
+    }
+
+    /// \brief  Return the number of elements in the linked list.
+    size_t size() const noexcept
+    {
+        return _count;
+    }
+
+    /// \brief  Determine if an OrderMaintainedList is empty.
+    ///
+    /// \return \c true if the list is empty, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return head() == nullptr;
+    }
+
+    /// \brief  Determine whether one node comes before another in the list.
+    ///
+    /// \param a    A pointer to an existing node in the list.
+    /// \param b    A pointer to an existing node in the list.
+    ///
+    /// \return \c true if \p a is nearer the head than \p b, \c false if it is
+    ///         the same node or further from the head.
+    bool precedes(const node_t *a, const node_t *b) const noexcept
+    {
+        return a->_group == b->_group ? a->_label < b->_label
+                                      : a->_group->label < b->_group->label;
+    }
+
+    /// \brief  Prepend a new item to the beginning of a linked list. The new
+    ///         item becomes the new head of the linked list.
+    ///
+    /// \param data The data to be added to the linked list.
+    /// \return A pointer to the to the prepended node.
+    node_t *prepend(const T &data)
+    {
+        return insert_node(data, nullptr);
+    }
+
+    /// \brief  Insert a new item into the linked list immediately following
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node A pointer to an existing node in the linked list.
+    ///
+    /// \return A pointer to the new item's node.
+    node_t *insert_after(const T &data, node_t *node)
+    {
+        return insert_node(data, node);
+    }
+
+    /// \brief  Insert a new item into the linked list immediately preceding
+    ///         the specified node.
+    ///
+    /// \param data The data to be inserted into the list.
+    /// \param node A pointer to an existing node in the linked list.
+    ///
+    /// \return A pointer to the new item's node.
+    node_t *insert_before(const T &data, node_t *node)
+    {
+        return insert_node(data, node->prev());
+    }
+
+    /// \brief  Append a new item to the end of the linked list.
+    ///
+    /// \param data The data to be appended to the linked list.
+    /// \return A pointer to the appended item's node.
+    node_t *append(const T &data)
+    {
+        return insert_node(data, tail());
+    }
+
+    /// \brief  Remove the specified node from the linked list.
+    ///
+    /// \param node A pointer to the node to be removed.
+    /// \return A pointer to the node following the removed node.
+    node_t *remove(node_t *node)
+    {
+        node_t     *next_node{node->_next};
+        group_t    *group{node->_group};
+
+        if (node->_prev == nullptr)
+            _head_node = next_node;
+        else
+            node->_prev->_next = next_node;
+
+        if (next_node == nullptr)
+            _tail_node = node->_prev;
+        else
+            next_node->_prev = node->_prev;
+
+        // The remaining labels keep their order, so nothing is relabelled.
+        if (--group->count == 0)
+            remove_group(group);
+
+        destroy_node(node);
+        --_count;
+        DS_LIST_STATS(_stats.record_deallocation();)
+
+        return next_node;
+    }
+
+    /// \brief  Erase the linked list. Memory allocated to nodes is reclaimed.
+    void erase()
+    {
+        node_t *current{head()};
+
+        while (current != nullptr)
+        {
+            node_t *next{current->next()};
+
+            destroy_node(current);
+            current = next;
+        }
+
+        while (_first_group != nullptr)
+            remove_group(_first_group);
+
+        DS_LIST_STATS(_stats.record_deallocation(_count);)
+
+        _head_node = _tail_node = nullptr;
+        _count = 0;
+    }
+
+    /// \brief  Return a copy of the list's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+    /// \brief  Locate the first node containing the given value.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// \remark Type \c T must be comparable to another object of type \c T
+    ///         via the equality operator (operator==).
+    node_t *find(const T &data)
+    {
+        node_t *current{head()};
+        DS_LIST_STATS(std::uint64_t probes{0};)
+
+        while (current != nullptr)
+        {
+            DS_LIST_STATS(++probes;)
+            if (current->_data == data)
+                break;
+
+            current = current->next();
+        }
+
+        DS_LIST_STATS(_stats.record_find(probes);)
+
+        return current;
+    }
+
+    /// \brief  Return the number of labels reassigned so far, to nodes and to
+    ///         groups, beyond the one given to each new node.
+    std::uint64_t relabel_count() const noexcept
+    {
+        return _relabel_count;
+    }
+
+    /// \brief  Return the list's instrumentation counters.
+    ///
+    /// The counters are maintained only when DS_ENABLE_STATS is defined;
+    /// otherwise all of the counters are zero.
+    const ListStats &stats() const noexcept
+    {
+#if defined(DS_ENABLE_STATS)
+        return _stats;
+#else
+        static const ListStats  no_stats{};
+        return no_stats;
+#endif
+    }
+
+    /// \brief  Reset the list's instrumentation counters. The peak size
+    ///         restarts from the current size.
+    void reset_stats() noexcept
+    {
+        DS_LIST_STATS(_stats = ListStats{};)
+        DS_LIST_STATS(_stats.record_size(_count);)
+    }
+
+private:
+    // Labels, of groups and of nodes within a group, are below 2^label_bits.
+    static constexpr unsigned       label_bits{62};
+    static constexpr std::uint64_t  label_limit{std::uint64_t{1} << label_bits};
+
+    // A range of 2^i group labels may be relabelled when it holds no more
+    // than (2 / 1.5)^i groups.
+    static constexpr double         range_density{2.0 / 1.5};
+
+    struct group_t
+    {
+        group_t        *prev{nullptr};
+        group_t        *next{nullptr};
+        std::uint64_t   label{0};
+        size_t          count{0};
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+    using group_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<group_t>;
+    using group_traits = std::allocator_traits<group_allocator>;
+
+    // Link a new node after another, or at the head if there is none, and
+    // give it a label.
+    node_t *insert_node(const T &data, node_t *previous)
+    {
+        node_t     *next_node{previous == nullptr ? _head_node : previous->_next};
+        group_t    *group{previous != nullptr ? previous->_group
+                          : next_node != nullptr ? next_node->_group : nullptr};
+
+        if (group == nullptr)
+        {
+            group = insert_group(nullptr);
+        }
+        else if (group->count == group_capacity)
+        {
+            split_group(group, previous != nullptr ? previous : next_node);
+            group = previous != nullptr ? previous->_group : next_node->_group;
+        }
+
+        node_t *new_node;
+
+        try
+        {
+            new_node = create_node(data);
+        }
+        catch (...)
+        {
+            if (group->count == 0)
+                remove_group(group);
+            throw;
+        }
+        DS_LIST_STATS(_stats.record_allocation(sizeof(node_t));)
+
+        new_node->_prev = previous;
+        new_node->_next = next_node;
+        if (previous == nullptr)
+            _head_node = new_node;
+        else
+            previous->_next = new_node;
+        if (next_node == nullptr)
+            _tail_node = new_node;
+        else
+            next_node->_prev = new_node;
+
+        new_node->_group = group;
+        ++group->count;
+
+        // Take the label midway between the neighbours in the same group.
+        std::uint64_t   lower{previous != nullptr && previous->_group == group
+                              ? previous->_label + 1 : 0};
+        std::uint64_t   upper{next_node != nullptr && next_node->_group == group
+                              ? next_node->_label : label_limit};
+
+        if (lower < upper)
+            new_node->_label = lower + (upper - lower) / 2;
+        else
+            relabel_nodes(first_in_group(new_node), group->count);
+
+        ++_count;
+        DS_LIST_STATS(_stats.record_size(_count);)
+
+        return new_node;
+    }
+
+    // Return the first node of the group holding a node.
+    static node_t *first_in_group(node_t *node) noexcept
+    {
+        while (node->_prev != nullptr && node->_prev->_group == node->_group)
+            node = node->_prev;
+
+        return node;
+    }
+
+    // Spread the labels of a run of nodes evenly through a group's labels.
+    void relabel_nodes(node_t *first, size_t count) noexcept
+    {
+        std::uint64_t   gap{label_limit / (count + 1)};
+
+        for (size_t i = 1; i <= count; ++i, first = first->_next)
+            first->_label = gap * i;
+
+        _relabel_count += count;
+    }
+
+    // Move the second half of a full group's nodes, one of which is given,
+    // to a new group after it.
+    void split_group(group_t *group, node_t *member)
+    {
+        group_t    *second{insert_group(group)};
+        node_t     *first{first_in_group(member)};
+
+        size_t  kept{group->count / 2};
+        node_t *middle{first};
+
+        for (size_t i = 0; i < kept; ++i)
+            middle = middle->_next;
+
+        for (node_t *node = middle; node != nullptr && node->_group == group; node = node->_next)
+            node->_group = second;
+
+        second->count = group->count - kept;
+        group->count = kept;
+
+        relabel_nodes(first, group->count);
+        relabel_nodes(middle, second->count);
+    }
+
+    // Link a new, empty group after another, or as the only group if there is
+    // none, and give it a label.
+    group_t *insert_group(group_t *previous)
+    {
+        group_t    *group{group_traits::allocate(_group_allocator, 1)};
+
+        group_traits::construct(_group_allocator, group);
+
+        if (previous == nullptr)
+        {
+            _first_group = group;
+            return group;
+        }
+
+        group->prev = previous;
+        group->next = previous->next;
+        previous->next = group;
+        if (group->next != nullptr)
+            group->next->prev = group;
+
+        std::uint64_t   lower{previous->label + 1};
+        std::uint64_t   upper{group->next != nullptr ? group->next->label : label_limit};
+
+        if (lower < upper)
+        {
+            group->label = lower + (upper - lower) / 2;
+            return group;
+        }
+
+        // Widen an aligned range of labels around the previous group until it
+        // is sparse enough, then spread its groups evenly through it.
+        group_t        *first{previous};
+        group_t        *last{group};
+        size_t          count{2};
+        double          allowed{1.0};
+
+        for (unsigned bits = 1; bits <= label_bits; ++bits)
+        {
+            std::uint64_t   range{std::uint64_t{1} << bits};
+            std::uint64_t   base{previous->label & ~(range - 1)};
+
+            allowed *= range_density;
+
+            while (first->prev != nullptr && first->prev->label >= base)
+            {
+                first = first->prev;
+                ++count;
+            }
+            while (last->next != nullptr && last->next->label < base + range)
+            {
+                last = last->next;
+                ++count;
+            }
+
+            if (double(count) <= allowed || bits == label_bits)
+            {
+                std::uint64_t   gap{range / count};
+
+                for (size_t i = 0; i < count; ++i, first = first->next)
+                    first->label = base + gap * i;
+
+                _relabel_count += count - 1;
+                break;
+            }
+        }
+
+        return group;
+    }
+
+    // Unlink an empty group and free it.
+    void remove_group(group_t *group) noexcept
+    {
+        if (group->prev == nullptr)
+            _first_group = group->next;
+        else
+            group->prev->next = group->next;
+        if (group->next != nullptr)
+            group->next->prev = group->prev;
+
+        group_traits::destroy(_group_allocator, group);
+        group_traits::deallocate(_group_allocator, group, 1);
+    }
+
+    // Obtain a node from the allocator and construct it with the given data.
+    node_t *create_node(const T &data)
+    {
+        node_t *node{node_traits::allocate(_allocator, 1)};
+
+        try
+        {
+            node_traits::construct(_allocator, node, data);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, node, 1);
+            throw;
+        }
+
+        return node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node_t *node)
+    {
+        node_traits::destroy(_allocator, node);
+        node_traits::deallocate(_allocator, node, 1);
+    }
+
+// Instance data
+private:
+    node_allocator  _allocator;                 ///< Allocator from which nodes are obtained
+    group_allocator _group_allocator;           ///< Allocator from which groups are obtained
+    node_t         *_head_node{nullptr};        ///< Pointer to the head node
+    node_t         *_tail_node{nullptr};        ///< Pointer to the tail node
+    group_t        *_first_group{nullptr};      ///< Group holding the head node
+    size_t          _count{0};                  ///< Number of elements in the linked list
+    std::uint64_t   _relabel_count{0};          ///< Labels reassigned so far
+#if defined(DS_ENABLE_STATS)
+    ListStats   _stats;                         ///< Instrumentation counters
+#endif
+};
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  An OrderMaintainedList that allocates its nodes from a
+///         \c std::pmr::memory_resource given to its constructor.
+///
+/// \see    pmr::DoubleLinkedList
+template<typename T>
+using OrderMaintainedList = ::OrderMaintainedList<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
+#endif // INC_ORDER_MAINTAINED_LIST
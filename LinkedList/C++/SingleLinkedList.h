@@ -6,8 +6,32 @@
 #ifndef INC_SINGLE_LINKED_LIST
 #define INC_SINGLE_LINKED_LIST
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "ListFile.h"
+#include "ListFilter.h"
+#include "ListOrganize.h"
+#include "ListPrefetch.h"
+#include "BulkRelease.h"
+#include "ListStats.h"
+#include "ListStream.h"
+
 /// \brief  An implementation of a singly-linked list.
-template<typename T>
+///
+/// \tparam T           The type of the elements held by the list.
+/// \tparam Allocator   The allocator from which the list's nodes are
+///                     obtained. It is rebound to the node type.
+template<typename T, typename Allocator = std::allocator<T>>
 class SingleLinkedList
 {
 public:
@@ -51,12 +75,68 @@ public:
         friend SingleLinkedList;
     };
 
+    /// \brief  The type of the allocator used by the list.
+    using allocator_type = Allocator;
+
     /// \brief  Default-construct an empty SingleLinkedList.
-    SingleLinkedList() noexcept = default;
+    SingleLinkedList() = default;
+
+    /// \brief  Construct an empty SingleLinkedList whose nodes are obtained from
+    ///         the given allocator.
+    explicit SingleLinkedList(const Allocator &allocator)
+      : _allocator(allocator)
+    {
+    }
 
     SingleLinkedList(const SingleLinkedList &) = delete;
     SingleLinkedList & operator=(const SingleLinkedList &) = delete;
 
+    /// \brief  Move-construct a SingleLinkedList, taking the nodes of another
+    ///         list, which is left empty.
+    ///
+    /// No node is copied, so pointers to the other list's nodes become
+    /// pointers into this list.
+    SingleLinkedList(SingleLinkedList &&other) noexcept
+      : _allocator(std::move(other._allocator))
+    {
+        take(other);
+    }
+
+    /// \brief  Replace the contents of the list with those of another list,
+    ///         which is left empty.
+    ///
+    /// The nodes are taken without being copied when the allocator
+    /// propagates on move assignment or the two allocators compare equal.
+    /// Otherwise this list's allocator cannot free the other list's nodes,
+    /// so their data is copied into new nodes instead.
+    SingleLinkedList & operator=(SingleLinkedList &&other)
+        noexcept(node_traits::propagate_on_container_move_assignment::value
+                 || node_traits::is_always_equal::value)
+    {
+        if (&other == this)
+            return *this;
+
+        erase();
+        _filter.reset();
+        _hits.reset();
+
+        if (node_traits::propagate_on_container_move_assignment::value
+            || _allocator == other._allocator)
+        {
+            move_allocator(other, typename node_traits::propagate_on_container_move_assignment{});
+            take(other);
+        }
+        else
+        {
+            for (node_t *node = other.head(); node != nullptr; node = node->next())
+                append(node->_data);
+            _filter = std::move(other._filter);
+            other.erase();
+        }
+
+        return *this;
+    }
+
     /// \brief  Destroy a Linked List.
     ///
     /// Any contained nodes will be removed and their memory reclaimed.
@@ -98,7 +178,8 @@ public:
     /// \return A pointer to the to the prepended node.
     node_t *prepend(const T &data)
     {
-        node_t *new_node{new node_t(data)};
+        node_t *new_node{create_node(data)};
+        DS_LIST_STATS(_stats.record_allocation(sizeof(node_t));)
 
         new_node->next(_head_node);
         if (is_empty())
@@ -106,6 +187,7 @@ public:
         _head_node = new_node;
 
         ++_count;
+        DS_LIST_STATS(_stats.record_size(_count);)
 
         return new_node;
     }
@@ -119,12 +201,16 @@ public:
     /// \return A pointer to the new item's node.
     node_t *insert_after(const T &data, node_t *node)
     {
-        node_t *new_node{new node_t(data)};
+        node_t *new_node{create_node(data)};
+        DS_LIST_STATS(_stats.record_allocation(sizeof(node_t));)
 
         new_node->next(node->next());
         node->next(new_node);
+        if (node == tail())
+            _tail_node = new_node;
 
         ++_count;
+        DS_LIST_STATS(_stats.record_size(_count);)
 
         return new_node;
     }
@@ -155,8 +241,9 @@ public:
             if (next == tail())
                 _tail_node = node;
 
-            delete next;
+            destroy_node(next);
             --_count;
+            DS_LIST_STATS(_stats.record_deallocation();)
         }
 
         return node->next();
@@ -170,7 +257,8 @@ public:
     /// \remark This function must traverse the linked list to find the node
     ///         previous to the specified node in order to keep the links
     ///         coherent. Unlike remove_after, this function may be used to
-    ///         remove the head node.
+    ///         remove the head node. If the node is not in the list, nothing
+    ///         is removed and \c nullptr is returned.
     node_t *remove(node_t *node)
     {
         node_t *next_node{node->next()};
@@ -182,20 +270,32 @@ public:
             else
                 _head_node = next_node;
 
-            delete node;
+            destroy_node(node);
             --_count;
+            DS_LIST_STATS(_stats.record_deallocation();)
             return next_node;
         }
         else
         {
             // Find the node previous to the node to be removed and remove_after that node.
             node_t *previous = _head_node;
+            DS_LIST_STATS(std::uint64_t probes{0};)
 
             while (previous != nullptr)
             {
+                DS_LIST_STATS(++probes;)
                 if (previous->next() == node)
+                {
+                    DS_LIST_STATS(_stats.record_remove_scan(probes);)
                     return remove_after(previous);
+                }
+
+                previous = previous->next();
             }
+
+            // The node is not in this list.
+            DS_LIST_STATS(_stats.record_remove_scan(probes);)
+            return nullptr;
         }
     }
 
@@ -208,14 +308,199 @@ public:
         {
             node_t *next{current->next()};
 
-            delete current;
+            destroy_node(current);
             current = next;
         }
 
+        DS_LIST_STATS(_stats.record_deallocation(_count);)
+
         _head_node = _tail_node = nullptr;
         _count = 0;
     }
 
+    /// \brief  Erase the linked list, prefetching nodes ahead of the one
+    ///         being freed.
+    ///
+    /// Behaves like erase(), but while each node is freed the node two
+    /// places ahead is already being loaded, so the traversal does not stall
+    /// on every \c next pointer when the nodes are scattered in memory.
+    void erase(prefetch_traversal_t)
+    {
+        node_t *current{head()};
+
+        if (current != nullptr)
+            DS_PREFETCH(current->next());
+
+        while (current != nullptr)
+        {
+            node_t *next{current->next()};
+
+            if (next != nullptr)
+                DS_PREFETCH(next->next());
+
+            destroy_node(current);
+            current = next;
+        }
+
+        DS_LIST_STATS(_stats.record_deallocation(_count);)
+
+        _head_node = _tail_node = nullptr;
+        _count = 0;
+    }
+
+    /// \brief  Abandon every node without visiting it, leaving the list empty.
+    ///
+    /// The nodes are neither destroyed nor returned to the allocator, so the
+    /// cost does not depend on the size of the list. This is intended for
+    /// lists whose allocator draws from an arena, such as ArenaAllocator:
+    /// after \c release the arena can be reset to reclaim every node at once.
+    /// It compiles only for allocators marked by \c releases_in_bulk, since
+    /// with any other allocator the nodes' memory would be leaked.
+    ///
+    /// \remark Type \c T must be trivially destructible.
+    void release() noexcept
+    {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "Only nodes holding trivially destructible data can be released");
+        static_assert(releases_in_bulk<Allocator>::value,
+                      "Only nodes from an allocator that frees them in bulk can be released");
+
+        DS_LIST_STATS(_stats.record_deallocation(_count);)
+
+        if (_filter != nullptr)
+            _filter->clear();
+        _hits.reset();
+
+        _block = nullptr;
+        _block_size = _block_live = 0;
+        _head_node = _tail_node = nullptr;
+        _count = 0;
+    }
+
+    /// \brief  Replace the contents of the list with the elements of a range,
+    ///         reusing the existing nodes.
+    ///
+    /// \param first    The beginning of the range of elements.
+    /// \param last     The end of the range.
+    ///
+    /// The existing nodes are overwritten in place, in order, so only the
+    /// difference in length is allocated or freed. Pointers to the nodes
+    /// that are kept remain valid, and refer to the new elements.
+    template<typename InputIterator>
+    void assign(InputIterator first, InputIterator last)
+    {
+        node_t *previous{nullptr};
+        node_t *current{head()};
+
+        for (; current != nullptr && first != last; ++first)
+        {
+            overwrite(current, *first);
+            previous = current;
+            current = current->next();
+        }
+
+        if (current != nullptr)
+        {
+            // Free the nodes left over.
+            size_t  removed{0};
+
+            if (previous == nullptr)
+                _head_node = nullptr;
+            else
+                previous->next(nullptr);
+            _tail_node = previous;
+
+            while (current != nullptr)
+            {
+                node_t *next{current->next()};
+
+                destroy_node(current);
+                current = next;
+                ++removed;
+            }
+
+            _count -= removed;
+            DS_LIST_STATS(_stats.record_deallocation(removed);)
+        }
+        else
+        {
+            for (; first != last; ++first)
+                previous = previous == nullptr ? prepend(*first) : insert_after(*first, previous);
+        }
+    }
+
+    /// \brief  Return a copy of the list whose nodes are allocated together,
+    ///         in list order, in one contiguous block.
+    ///
+    /// Copying takes a single allocation, and traversing the copy reads
+    /// memory sequentially. Nodes may still be added to and removed from
+    /// the copy; the block is returned to the allocator once every node in
+    /// it has been removed. The copy's allocator is chosen by
+    /// \c select_on_container_copy_construction. The copy keeps no
+    /// membership filter.
+    SingleLinkedList clone() const
+    {
+        return SingleLinkedList(*this, clone_t{});
+    }
+
+    /// \brief  Return a copy of the list's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+    /// \brief  Keep a membership filter, so that \c find can reject values
+    ///         that are not in the list without walking it.
+    ///
+    /// \tparam Hash   The hash function object for type \c T. It must be
+    ///                 default-constructible.
+    /// \param expected_size       The number of elements the filter is sized
+    ///                             for. The current size is used if larger.
+    /// \param false_positive_rate The proportion of absent values that are
+    ///                             still searched for, at the expected size.
+    ///
+    /// Every \c find overload asks the filter first, and returns \c nullptr
+    /// at once for a value the filter knows to be absent. The filter is a
+    /// CountingBloomFilter, built from the current elements and then kept up
+    /// to date as nodes are created and destroyed. Calling \c enable_filter
+    /// again rebuilds it, which is needed once the list has grown well past
+    /// the expected size, or if elements have been changed through
+    /// \c node_t::data().
+    ///
+    /// \throw std::invalid_argument if \p false_positive_rate is not strictly
+    ///        between 0 and 1.
+    template<typename Hash = std::hash<T>>
+    void enable_filter(size_t expected_size, double false_positive_rate = 0.01)
+    {
+        auto    filter{std::make_unique<CountingBloomFilter<T>>(
+                    std::max(expected_size, size()), false_positive_rate,
+                    [](const T &value) -> std::size_t { return Hash{}(value); })};
+
+        for (node_t *node = head(); node != nullptr; node = node->next())
+            filter->insert(node->_data);
+
+        _filter = std::move(filter);
+    }
+
+    /// \brief  Stop keeping a membership filter, and free it.
+    void disable_filter() noexcept
+    {
+        _filter.reset();
+    }
+
+    /// \brief  Determine whether the list keeps a membership filter.
+    bool has_filter() const noexcept
+    {
+        return _filter != nullptr;
+    }
+
+    /// \brief  Return the size of the membership filter and the counts of the
+    ///         lookups it has answered, or zeros if there is no filter.
+    FilterStats filter_stats() const noexcept
+    {
+        return _filter != nullptr ? _filter->stats() : FilterStats{};
+    }
+
     /// \brief  Locate the first node containing the given data value.
     ///
     /// \param data Reference to an object of type \c T to be searched for.
@@ -226,25 +511,559 @@ public:
     /// \remark Type \c T must be comparable to another object of type \c T
     ///         via the equality operator (operator==).
     node_t *find(const T &data)
+    {
+        if (filter_rejects(data))
+            return nullptr;
+
+        node_t *current{head()};
+        DS_LIST_STATS(std::uint64_t probes{0};)
+
+        while (current != nullptr)
+        {
+            DS_LIST_STATS(++probes;)
+            if (current->data() == data)
+                break;
+
+            current = current->next();
+        }
+
+        DS_LIST_STATS(_stats.record_find(probes);)
+        filter_searched(current);
+
+        return current;
+    }
+
+    /// \brief  Locate the first node containing the given data value,
+    ///         prefetching nodes ahead of the one being examined.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// The node after the next one is prefetched while the current node is
+    /// compared, so the load of each \c next pointer overlaps with the work
+    /// on the node before it. This helps when the nodes are scattered in
+    /// memory and the comparison is not trivial; when the nodes are
+    /// contiguous the hardware prefetcher usually does as well without it.
+    node_t *find(const T &data, prefetch_traversal_t)
+    {
+        if (filter_rejects(data))
+            return nullptr;
+
+        node_t *current{head()};
+        DS_LIST_STATS(std::uint64_t probes{0};)
+
+        if (current != nullptr)
+            DS_PREFETCH(current->next());
+
+        while (current != nullptr)
+        {
+            node_t *next{current->next()};
+
+            if (next != nullptr)
+                DS_PREFETCH(next->next());
+
+            DS_LIST_STATS(++probes;)
+            if (current->data() == data)
+                break;
+
+            current = next;
+        }
+
+        DS_LIST_STATS(_stats.record_find(probes);)
+        filter_searched(current);
+
+        return current;
+    }
+
+    /// \brief  Locate the first node containing the given value, and move it
+    ///         to the head of the list.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// \see    move_to_front_t
+    node_t *find(const T &data, move_to_front_t)
+    {
+        node_t *previous{nullptr};
+        node_t *current{search(data, previous)};
+
+        if (current != nullptr && previous != nullptr)
+        {
+            unlink_after(previous);
+            current->next(_head_node);
+            _head_node = current;
+        }
+
+        return current;
+    }
+
+    /// \brief  Locate the first node containing the given value, and exchange
+    ///         it with the node before it.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// \see    transpose_t
+    node_t *find(const T &data, transpose_t)
+    {
+        if (filter_rejects(data))
+            return nullptr;
+
+        node_t *before_previous{nullptr};
+        node_t *previous{nullptr};
+        node_t *current{head()};
+        DS_LIST_STATS(std::uint64_t probes{0};)
+
+        while (current != nullptr)
+        {
+            DS_LIST_STATS(++probes;)
+            if (current->data() == data)
+                break;
+
+            before_previous = previous;
+            previous = current;
+            current = current->next();
+        }
+
+        DS_LIST_STATS(_stats.record_find(probes);)
+        filter_searched(current);
+
+        if (current != nullptr && previous != nullptr)
+        {
+            unlink_after(previous);
+            link_after(before_previous, current, previous);
+        }
+
+        return current;
+    }
+
+    /// \brief  Locate the first node containing the given value, count the
+    ///         lookup, and move the node ahead of any nodes with lower counts.
+    ///
+    /// \param data Reference to an object of type \c T to be searched for.
+    ///
+    /// \return A pointer to the list node containing the specified value,
+    ///         or \c nullptr if the data item was not found.
+    ///
+    /// \see    frequency_count_t
+    node_t *find(const T &data, frequency_count_t)
+    {
+        node_t *previous{nullptr};
+        node_t *current{search(data, previous)};
+
+        if (current == nullptr)
+            return nullptr;
+
+        if (_hits == nullptr)
+            _hits = std::make_unique<hit_table>();
+
+        std::uint32_t  &count{(*_hits)[current]};
+
+        if (count != std::numeric_limits<std::uint32_t>::max())
+            ++count;
+
+        // Find the first node with a lower count, which can only be ahead of
+        // the node found.
+        node_t *before{nullptr};
+        node_t *scan{head()};
+
+        while (scan != current && hits(scan) >= count)
+        {
+            before = scan;
+            scan = scan->next();
+        }
+
+        if (scan != current)
+        {
+            unlink_after(previous);
+            link_after(before, current, scan);
+        }
+
+        return current;
+    }
+
+    /// \brief  Save the linked list to a file.
+    ///
+    /// \param path Name of the file to be written.
+    ///
+    /// \return \c true if the file was written successfully, \c false otherwise.
+    ///
+    /// The file can later be opened with MappedList, which maps it into
+    /// memory and traverses it in place instead of rebuilding the list.
+    ///
+    /// \remark Type \c T must be trivially copyable.
+    bool save(const char *path) const
+    {
+        return list_file::save<T>(path, head(), size());
+    }
+
+    /// \brief  Write the linked list to a stream in a binary format.
+    ///
+    /// \param writer   The destination, such as a \c std::ostream opened in
+    ///                 binary mode.
+    ///
+    /// \return \c true if the list was written successfully, \c false otherwise.
+    ///
+    /// The elements are streamed in chunks through a fixed-size buffer; see
+    /// ListStream.h for the format.
+    ///
+    /// \remark Type \c T must be trivially copyable. Other types can be
+    ///         written with the overload that takes an encoder.
+    template<typename Writer>
+    bool serialize(Writer &writer) const
+    {
+        return list_stream::write<T>(writer, head(), size());
+    }
+
+    /// \brief  Write the linked list to a stream, encoding each element with
+    ///         a caller-supplied function.
+    ///
+    /// \param writer   The destination of the serialized list.
+    /// \param encode   Function called as \c encode(writer, data) for each
+    ///                 element, returning \c false on failure.
+    ///
+    /// \return \c true if the list was written successfully, \c false otherwise.
+    template<typename Writer, typename Encoder>
+    bool serialize(Writer &writer, Encoder encode) const
+    {
+        return list_stream::write(writer, head(), size(), encode);
+    }
+
+    /// \brief  Replace the contents of the linked list with a list read from
+    ///         a stream written by serialize.
+    ///
+    /// \param reader   The source, such as a \c std::istream opened in binary
+    ///                 mode.
+    ///
+    /// \return \c true if a complete list was read, \c false otherwise. On
+    ///         failure the list holds the elements read before the error.
+    ///
+    /// \remark Type \c T must be trivially copyable. Other types can be
+    ///         read with the overload that takes a decoder.
+    template<typename Reader>
+    bool deserialize(Reader &reader)
+    {
+        node_t *last{nullptr};
+
+        erase();
+        return list_stream::read<T>(reader, [&](const T &data)
+            {
+                last = last == nullptr ? prepend(data) : insert_after(data, last);
+            });
+    }
+
+    /// \brief  Replace the contents of the linked list with a list read from
+    ///         a stream, decoding each element with a caller-supplied function.
+    ///
+    /// \param reader   The source of the serialized list.
+    /// \param decode   Function called as \c decode(reader, data) to read each
+    ///                 element, returning \c false on failure.
+    ///
+    /// \return \c true if a complete list was read, \c false otherwise. On
+    ///         failure the list holds the elements read before the error.
+    template<typename Reader, typename Decoder>
+    bool deserialize(Reader &reader, Decoder decode)
+    {
+        node_t *last{nullptr};
+
+        erase();
+        return list_stream::read<T>(reader, decode, [&](const T &data)
+            {
+                last = last == nullptr ? prepend(data) : insert_after(data, last);
+            });
+    }
+
+    /// \brief  Return the list's instrumentation counters.
+    ///
+    /// The counters are maintained only when DS_ENABLE_STATS is defined;
+    /// otherwise all of the counters are zero.
+    const ListStats &stats() const noexcept
+    {
+#if defined(DS_ENABLE_STATS)
+        return _stats;
+#else
+        static const ListStats  no_stats{};
+        return no_stats;
+#endif
+    }
+
+    /// \brief  Reset the list's instrumentation counters. The peak size
+    ///         restarts from the current size.
+    void reset_stats() noexcept
+    {
+        DS_LIST_STATS(_stats = ListStats{};)
+        DS_LIST_STATS(_stats.record_size(_count);)
+    }
+
+private:
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+    using hit_table = std::unordered_map<const node_t *, std::uint32_t>;
+
+    // Search for a node holding a value, recording the probes, and return
+    // it together with the node before it.
+    node_t *search(const T &data, node_t *&previous)
     {
         node_t *current{head()};
+        DS_LIST_STATS(std::uint64_t probes{0};)
+
+        previous = nullptr;
+        if (filter_rejects(data))
+            return nullptr;
 
         while (current != nullptr)
         {
+            DS_LIST_STATS(++probes;)
             if (current->data() == data)
                 break;
 
+            previous = current;
             current = current->next();
         }
 
+        DS_LIST_STATS(_stats.record_find(probes);)
+        filter_searched(current);
+
         return current;
     }
 
+    // Unlink the node following another, without destroying it.
+    void unlink_after(node_t *previous) noexcept
+    {
+        node_t *node{previous->next()};
+
+        previous->next(node->next());
+        if (node == _tail_node)
+            _tail_node = previous;
+    }
+
+    // Link an unlinked node between two adjacent nodes. A null previous node
+    // means the head of the list; next is then the current head.
+    void link_after(node_t *previous, node_t *node, node_t *next) noexcept
+    {
+        node->next(next);
+        if (previous == nullptr)
+            _head_node = node;
+        else
+            previous->next(node);
+    }
+
+    // Ask the membership filter, if any, whether a value is certainly not
+    // in the list. A rejected lookup counts as a find with no probes.
+    bool filter_rejects(const T &data)
+    {
+        if (_filter == nullptr || _filter->may_contain(data))
+            return false;
+
+        DS_LIST_STATS(_stats.record_find(0);)
+        return true;
+    }
+
+    // Tell the membership filter, if any, the result of a search it allowed.
+    void filter_searched(const node_t *found) noexcept
+    {
+        if (found == nullptr && _filter != nullptr)
+            _filter->record_false_positive();
+    }
+
+    // Tag selecting the constructor used by clone.
+    struct clone_t {};
+
+    // Construct a copy of another list, with all of its nodes carved from a
+    // single allocation.
+    SingleLinkedList(const SingleLinkedList &other, clone_t)
+      : _allocator(node_traits::select_on_container_copy_construction(other._allocator))
+    {
+        if (other.is_empty())
+            return;
+
+        _block = node_traits::allocate(_allocator, other.size());
+        _block_size = other.size();
+
+        try
+        {
+            node_t *node{_block};
+
+            for (node_t *source = other.head(); source != nullptr; source = source->next(), ++node)
+            {
+                node_traits::construct(_allocator, node, source->_data);
+                ++_block_live;
+                if (_tail_node == nullptr)
+                    _head_node = node;
+                else
+                    _tail_node->next(node);
+                _tail_node = node;
+                ++_count;
+            }
+        }
+        catch (...)
+        {
+            erase();
+            if (_block != nullptr)
+                free_block();
+            throw;
+        }
+
+        DS_LIST_STATS(_stats.record_allocation(sizeof(node_t), _count);)
+        DS_LIST_STATS(_stats.record_size(_count);)
+    }
+
+    // Replace the data of a node, keeping the membership filter current.
+    void overwrite(node_t *node, const T &data)
+    {
+        if (_filter != nullptr)
+        {
+            T   old_data{node->_data};
+
+            node->_data = data;
+            _filter->remove(old_data);
+            _filter->insert(node->_data);
+        }
+        else
+        {
+            node->_data = data;
+        }
+
+        forget_hits(node);
+    }
+
+    // Take every node of another list, which is left empty, together with
+    // its filter, lookup counts and clone block. The allocators must
+    // already be equal.
+    void take(SingleLinkedList &other) noexcept
+    {
+        _head_node = other._head_node;
+        _tail_node = other._tail_node;
+        _count = other._count;
+        _filter = std::move(other._filter);
+        _hits = std::move(other._hits);
+        _block = other._block;
+        _block_size = other._block_size;
+        _block_live = other._block_live;
+        DS_LIST_STATS(_stats.record_size(_count);)
+
+        other._head_node = other._tail_node = nullptr;
+        other._block = nullptr;
+        other._count = other._block_size = other._block_live = 0;
+    }
+
+    // Adopt another list's allocator, if it propagates on move assignment.
+    void move_allocator(SingleLinkedList &other, std::true_type) noexcept
+    {
+        _allocator = std::move(other._allocator);
+    }
+
+    void move_allocator(SingleLinkedList &, std::false_type) noexcept
+    {
+    }
+
+    // Return the block allocated by clone to the allocator.
+    void free_block() noexcept
+    {
+        node_traits::deallocate(_allocator, _block, _block_size);
+        _block = nullptr;
+        _block_size = _block_live = 0;
+    }
+
+    // Return the number of lookups of a node counted by
+    // find(data, frequency_count).
+    std::uint32_t hits(const node_t *node) const
+    {
+        if (_hits == nullptr)
+            return 0;
+
+        auto    found{_hits->find(node)};
+
+        return found == _hits->end() ? 0 : found->second;
+    }
+
+    // Drop the lookup count, if any, of a node.
+    void forget_hits(const node_t *node)
+    {
+        if (_hits != nullptr)
+            _hits->erase(node);
+    }
+
+    // Obtain a node from the allocator and construct it with the given data.
+    node_t *create_node(const T &data)
+    {
+        node_t *node{node_traits::allocate(_allocator, 1)};
+
+        try
+        {
+            node_traits::construct(_allocator, node, data);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, node, 1);
+            throw;
+        }
+
+        if (_filter != nullptr)
+            _filter->insert(node->_data);
+
+        return node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node_t *node)
+    {
+        if (_filter != nullptr)
+            _filter->remove(node->_data);
+        forget_hits(node);
+
+        node_traits::destroy(_allocator, node);
+
+        // Nodes made by clone are freed together, with the last of them.
+        std::less<const node_t *>   before;
+
+        if (_block != nullptr && !before(node, _block) && before(node, _block + _block_size))
+        {
+            if (--_block_live == 0)
+                free_block();
+        }
+        else
+        {
+            node_traits::deallocate(_allocator, node, 1);
+        }
+    }
+
 // Instance data
 private:
+    node_allocator  _allocator;     ///< Allocator from which nodes are obtained
     node_t *_head_node{nullptr};    ///< Pointer to head node
     node_t *_tail_node{nullptr};    ///< Pointer to tail node
     size_t  _count{0};              ///< Number of elements in the linked list
+    std::unique_ptr<CountingBloomFilter<T>> _filter;   ///< Membership filter, if enabled
+    std::unique_ptr<hit_table>  _hits;  ///< Lookup counts of find(data, frequency_count), if used
+    node_t *_block{nullptr};        ///< Nodes allocated together by clone
+    size_t  _block_size{0};         ///< Number of nodes in the block
+    size_t  _block_live{0};         ///< Nodes in the block not yet destroyed
+#if defined(DS_ENABLE_STATS)
+    ListStats   _stats;             ///< Instrumentation counters
+#endif
 };
 
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  A SingleLinkedList whose nodes are obtained from a \c std::pmr::memory_resource.
+///
+/// Every SingleLinkedList of this type has the same type regardless of the memory
+/// resource it uses, so code written for it serves all allocation strategies
+/// without being instantiated for each. The resource is passed to the
+/// constructor; the default constructor uses \c std::pmr::get_default_resource.
+template<typename T>
+using SingleLinkedList = ::SingleLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
 #endif // INC_SINGLE_LINKED_LIST
@@ -0,0 +1,554 @@
+/// \file   SplitOrderedHashSet.h
+/// \brief  A lock-free hash set whose buckets index one split-ordered list
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_SPLIT_ORDERED_HASH_SET
+#define INC_SPLIT_ORDERED_HASH_SET
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "EpochReclamation.h"
+
+/// \brief  A hash set that any number of threads may search and change at
+///         once without locks, and which grows without ever moving an
+///         element.
+///
+/// \tparam T           The type of the elements held by the set.
+/// \tparam Hash        The hash function for the elements.
+/// \tparam KeyEqual    The equality of the elements.
+/// \tparam Allocator   The allocator from which the list's nodes are
+///                     obtained. It is rebound to the node types, and must
+///                     be safe to use from several threads at once.
+///
+/// This is the split-ordered list of Shalev and Shavit. Every element lives
+/// in a single lock-free sorted list, as in LockFreeOrderedList, ordered by
+/// its hash with the bits reversed. In that order the elements of bucket
+/// \c b of a table of \c n buckets form one run of the list, and doubling
+/// the table splits each run in two, in place. Each bucket therefore needs
+/// only a pointer to a dummy node at the start of its run. Doubling the
+/// table is a single atomic store. A new bucket's dummy node is linked in
+/// the first time the bucket is used, by splitting its parent bucket's run,
+/// so resizing happens a bucket at a time and never blocks a lookup.
+///
+/// The bucket pointers are kept in segments of doubling size, allocated as
+/// they are first needed, so the table never has to be copied.
+///
+/// Removed elements are passed to an EpochDomain, shared by default with
+/// every other lock-free structure. Dummy nodes are never removed.
+template<typename T,
+         typename Hash = std::hash<T>,
+         typename KeyEqual = std::equal_to<T>,
+         typename Allocator = std::allocator<T>>
+class SplitOrderedHashSet
+{
+public:
+    /// \brief  The type of the allocator used by the set.
+    using allocator_type = Allocator;
+
+    /// \brief  The average number of elements per bucket above which the
+    ///         number of buckets is doubled.
+    static constexpr size_t max_load_factor{2};
+
+    /// \brief  Construct an empty set, whose removed nodes are reclaimed
+    ///         through the given domain.
+    explicit SplitOrderedHashSet(EpochDomain &domain = EpochDomain::shared(),
+                                 const Allocator &allocator = Allocator())
+      : _node_allocator(allocator),
+        _dummy_allocator(allocator),
+        _domain{domain}
+    {
+        _segments[0].store(new std::atomic<link_t *>[segment_size(0)]());
+        _segments[0].load()[0].store(&_head);
+    }
+
+    SplitOrderedHashSet(const SplitOrderedHashSet &) = delete;
+    SplitOrderedHashSet & operator=(const SplitOrderedHashSet &) = delete;
+
+    /// \brief  Destroy the set and reclaim its nodes. No other thread may be
+    ///         using the set.
+    ~SplitOrderedHashSet()
+    {
+        link_t *current{pointer(_head.next.load())};
+
+        while (current != nullptr)
+        {
+            link_t *next{pointer(current->next.load())};
+
+            if (is_dummy(current->key))
+                destroy_dummy(current);
+            else
+                destroy_node(static_cast<node_t *>(current));
+            current = next;
+        }
+
+        for (auto &segment : _segments)
+            delete[] segment.load();
+
+        _domain.drain(this);
+    }
+
+    /// \brief  Return the number of elements in the set. If other threads
+    ///         are changing the set, the result may already be out of date.
+    size_t size() const noexcept
+    {
+        return _count.load(std::memory_order_relaxed);
+    }
+
+    /// \brief  Determine if the set is empty. If other threads are changing
+    ///         the set, the result may already be out of date.
+    bool is_empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /// \brief  Return the number of buckets in the table.
+    size_t bucket_count() const noexcept
+    {
+        return _bucket_count.load(std::memory_order_relaxed);
+    }
+
+    /// \brief  Add an element to the set.
+    ///
+    /// \return \c true if the element was added, or \c false if an equal
+    ///         element was already present.
+    bool insert(const T &data)
+    {
+        EpochDomain::guard  guard(_domain);
+        const size_t        hash{_hash(data)};
+        const std::uint64_t key{regular_key(hash)};
+        link_t             *start{bucket(hash & (bucket_count() - 1))};
+        node_t             *new_node{nullptr};
+        size_t              count{0};
+
+        for (;;)
+        {
+            position    at{search(start, key, &data)};
+
+            if (at.found)
+            {
+                // The node was never visible to another thread.
+                if (new_node != nullptr)
+                {
+                    destroy_node(new_node);
+                    --_count;
+                }
+                return false;
+            }
+
+            // The node is counted before it is published, so that a thread
+            // removing it at once cannot take the count below zero.
+            if (new_node == nullptr)
+            {
+                new_node = create_node(data, key);
+                count = ++_count;
+            }
+            new_node->next.store(address(at.current), std::memory_order_relaxed);
+
+            std::uintptr_t  expected{address(at.current)};
+
+            if (at.previous->next.compare_exchange_strong(expected, address(new_node),
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed))
+                break;
+        }
+
+        // Double the table once the buckets hold too many elements on
+        // average. The new buckets are filled in as they are first used.
+        size_t  buckets{bucket_count()};
+
+        if (count > buckets * max_load_factor && buckets < max_bucket_count)
+            _bucket_count.compare_exchange_strong(buckets, buckets * 2);
+
+        return true;
+    }
+
+    /// \brief  Remove an element from the set.
+    ///
+    /// \return \c true if the element was removed, or \c false if it was not
+    ///         present.
+    bool remove(const T &data)
+    {
+        EpochDomain::guard  guard(_domain);
+        const size_t        hash{_hash(data)};
+        const std::uint64_t key{regular_key(hash)};
+        link_t             *start{bucket(hash & (bucket_count() - 1))};
+
+        for (;;)
+        {
+            position    at{search(start, key, &data)};
+
+            if (!at.found)
+                return false;
+
+            // Mark the node deleted. Whoever succeeds has removed it.
+            std::uintptr_t  next{at.current->next.load(std::memory_order_acquire)};
+
+            if (is_marked(next)
+                || !at.current->next.compare_exchange_strong(next, next | mark_bit,
+                                                             std::memory_order_acq_rel,
+                                                             std::memory_order_relaxed))
+                continue;
+
+            --_count;
+
+            // Try to unlink it; if that fails, a search will do so instead.
+            std::uintptr_t  expected{address(at.current)};
+
+            if (at.previous->next.compare_exchange_strong(expected, next,
+                                                          std::memory_order_acq_rel,
+                                                          std::memory_order_relaxed))
+                retire(static_cast<node_t *>(at.current));
+            else
+                search(start, key, &data);
+
+            return true;
+        }
+    }
+
+    /// \brief  Determine whether the set holds an element. Apart from linking
+    ///         in the bucket's dummy node the first time the bucket is used,
+    ///         this never changes the list.
+    bool contains(const T &data) const
+    {
+        EpochDomain::guard  guard(_domain);
+        const size_t        hash{_hash(data)};
+        const std::uint64_t key{regular_key(hash)};
+
+        // Linking in a dummy node does not change the elements of the set.
+        // Without it, a lookup in an unused bucket would have to search the
+        // whole run of an ancestor bucket.
+        link_t *current{const_cast<SplitOrderedHashSet *>(this)->bucket(hash & (bucket_count() - 1))};
+
+        for (; current != nullptr && current->key <= key;
+             current = pointer(current->next.load(std::memory_order_acquire)))
+        {
+            if (current->key == key
+                && _equal(static_cast<const node_t *>(current)->data, data))
+                return !is_marked(current->next.load(std::memory_order_acquire));
+        }
+
+        return false;
+    }
+
+    /// \brief  Call a function with every element of the set. Elements added
+    ///         or removed during the call may or may not be visited.
+    template<typename Function>
+    void for_each(Function func) const
+    {
+        EpochDomain::guard  guard(_domain);
+        link_t             *current{pointer(_head.next.load(std::memory_order_acquire))};
+
+        while (current != nullptr)
+        {
+            std::uintptr_t  next{current->next.load(std::memory_order_acquire)};
+
+            if (!is_dummy(current->key) && !is_marked(next))
+                func(static_cast<const T &>(static_cast<node_t *>(current)->data));
+            current = pointer(next);
+        }
+    }
+
+    /// \brief  Return a copy of the allocator used by the set.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_node_allocator);
+    }
+
+private:
+    // The low bit of a next pointer marks its node as deleted.
+    static constexpr std::uintptr_t mark_bit{1};
+
+    // The number of segments of bucket pointers. Segment 0 holds buckets 0
+    // and 1, and segment s holds buckets 2^s up to 2^(s+1) - 1.
+    static constexpr size_t segment_count{sizeof(size_t) * 8 - 1};
+
+    static constexpr size_t max_bucket_count{size_t{1} << (segment_count - 1)};
+
+    // A node of the list. Dummy nodes marking the start of a bucket have an
+    // even key and hold no data; nodes holding elements have an odd key.
+    struct link_t
+    {
+        explicit link_t(std::uint64_t split_key)
+          : key{split_key}
+        {}
+
+        std::atomic<std::uintptr_t> next{0};
+        std::uint64_t               key;
+    };
+
+    struct node_t : link_t
+    {
+        node_t(const T &value, std::uint64_t split_key)
+          : link_t(split_key),
+            data{value}
+        {}
+
+        T   data;
+    };
+
+    // Where a node belongs: the first node ordered after it or holding an
+    // equal element, and the link leading to that node.
+    struct position
+    {
+        link_t *previous;
+        link_t *current;
+        bool    found;
+    };
+
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+    using dummy_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<link_t>;
+    using dummy_traits = std::allocator_traits<dummy_allocator>;
+
+    static link_t *pointer(std::uintptr_t link) noexcept
+    {
+        return reinterpret_cast<link_t *>(link & ~mark_bit);
+    }
+
+    static std::uintptr_t address(link_t *node) noexcept
+    {
+        return reinterpret_cast<std::uintptr_t>(node);
+    }
+
+    static bool is_marked(std::uintptr_t link) noexcept
+    {
+        return (link & mark_bit) != 0;
+    }
+
+    static bool is_dummy(std::uint64_t key) noexcept
+    {
+        return (key & 1) == 0;
+    }
+
+    static std::uint64_t reverse_bits(std::uint64_t value) noexcept
+    {
+        value = ((value >> 1) & 0x5555555555555555ULL) | ((value & 0x5555555555555555ULL) << 1);
+        value = ((value >> 2) & 0x3333333333333333ULL) | ((value & 0x3333333333333333ULL) << 2);
+        value = ((value >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((value & 0x0F0F0F0F0F0F0F0FULL) << 4);
+        value = ((value >> 8) & 0x00FF00FF00FF00FFULL) | ((value & 0x00FF00FF00FF00FFULL) << 8);
+        value = ((value >> 16) & 0x0000FFFF0000FFFFULL) | ((value & 0x0000FFFF0000FFFFULL) << 16);
+        return (value >> 32) | (value << 32);
+    }
+
+    // The key of an element, with the top bit of the hash set so that it
+    // sorts after the dummy node of every bucket it could belong to.
+    static std::uint64_t regular_key(size_t hash) noexcept
+    {
+        return reverse_bits(static_cast<std::uint64_t>(hash) | (std::uint64_t{1} << 63));
+    }
+
+    static std::uint64_t dummy_key(size_t index) noexcept
+    {
+        return reverse_bits(index);
+    }
+
+    // The bucket whose run a bucket's run was split from: the bucket's
+    // index with its highest set bit cleared.
+    static size_t parent(size_t index) noexcept
+    {
+        size_t  bit{1};
+
+        while (bit <= index / 2)
+            bit <<= 1;
+
+        return index & ~bit;
+    }
+
+    static size_t segment_size(size_t segment) noexcept
+    {
+        return segment == 0 ? 2 : size_t{1} << segment;
+    }
+
+    // Return the slot holding a bucket's dummy node pointer, allocating its
+    // segment if this is the first bucket of the segment to be used.
+    std::atomic<link_t *> &bucket_slot(size_t index)
+    {
+        size_t  segment{0};
+        size_t  first{0};
+
+        if (index >= 2)
+        {
+            for (segment = 1, first = 2; first <= index / 2; first <<= 1)
+                ++segment;
+        }
+
+        std::atomic<link_t *>  *slots{_segments[segment].load(std::memory_order_acquire)};
+
+        if (slots == nullptr)
+        {
+            std::atomic<link_t *>  *fresh{new std::atomic<link_t *>[segment_size(segment)]()};
+
+            if (_segments[segment].compare_exchange_strong(slots, fresh))
+                slots = fresh;
+            else
+                delete[] fresh;
+        }
+
+        return slots[index - first];
+    }
+
+    // Return the dummy node of a bucket, linking it in if need be.
+    link_t *bucket(size_t index)
+    {
+        std::atomic<link_t *>  &slot{bucket_slot(index)};
+        link_t                 *dummy{slot.load(std::memory_order_acquire)};
+
+        if (dummy != nullptr)
+            return dummy;
+
+        const std::uint64_t key{dummy_key(index)};
+        link_t             *start{bucket(parent(index))};
+        link_t             *new_dummy{create_dummy(key)};
+
+        for (;;)
+        {
+            position    at{search(start, key, nullptr)};
+
+            if (at.found)
+            {
+                // Another thread linked in the dummy node first.
+                destroy_dummy(new_dummy);
+                dummy = at.current;
+                break;
+            }
+
+            new_dummy->next.store(address(at.current), std::memory_order_relaxed);
+
+            std::uintptr_t  expected{address(at.current)};
+
+            if (at.previous->next.compare_exchange_strong(expected, address(new_dummy),
+                                                          std::memory_order_release,
+                                                          std::memory_order_relaxed))
+            {
+                dummy = new_dummy;
+                break;
+            }
+        }
+
+        slot.store(dummy, std::memory_order_release);
+        return dummy;
+    }
+
+    // Find where a node belongs, starting from a dummy node and unlinking
+    // any marked nodes on the way. An element node is found if it holds an
+    // element equal to data; a dummy node, when data is null, if its key
+    // matches. Must be called with a guard held.
+    position search(link_t *start, std::uint64_t key, const T *data)
+    {
+        for (;;)
+        {
+            link_t *previous{start};
+            link_t *current{pointer(previous->next.load(std::memory_order_acquire))};
+            bool    restart{false};
+
+            while (current != nullptr)
+            {
+                std::uintptr_t  next{current->next.load(std::memory_order_acquire)};
+
+                if (is_marked(next))
+                {
+                    // Fails if the predecessor changed or was itself marked,
+                    // in which case the search starts again.
+                    std::uintptr_t  expected{address(current)};
+
+                    if (!previous->next.compare_exchange_strong(expected, next & ~mark_bit,
+                                                                std::memory_order_acq_rel,
+                                                                std::memory_order_acquire))
+                    {
+                        restart = true;
+                        break;
+                    }
+
+                    retire(static_cast<node_t *>(current));
+                    current = pointer(next);
+                    continue;
+                }
+
+                if (current->key > key)
+                    return {previous, current, false};
+
+                // Elements whose hashes are equal share a key, so look
+                // through all of them.
+                if (current->key == key
+                    && (data == nullptr || _equal(static_cast<node_t *>(current)->data, *data)))
+                    return {previous, current, true};
+
+                previous = current;
+                current = pointer(next);
+            }
+
+            if (!restart)
+                return {previous, nullptr, false};
+        }
+    }
+
+    void retire(node_t *node)
+    {
+        _domain.retire(node, [](void *object, void *context)
+                             {
+                                 static_cast<SplitOrderedHashSet *>(context)
+                                     ->destroy_node(static_cast<node_t *>(object));
+                             },
+                       this);
+    }
+
+    // Obtain a node from the allocator and construct it with the given data.
+    node_t *create_node(const T &data, std::uint64_t key)
+    {
+        node_t *node{node_traits::allocate(_node_allocator, 1)};
+
+        try
+        {
+            node_traits::construct(_node_allocator, node, data, key);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_node_allocator, node, 1);
+            throw;
+        }
+
+        return node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node_t *node)
+    {
+        node_traits::destroy(_node_allocator, node);
+        node_traits::deallocate(_node_allocator, node, 1);
+    }
+
+    link_t *create_dummy(std::uint64_t key)
+    {
+        link_t *dummy{dummy_traits::allocate(_dummy_allocator, 1)};
+
+        dummy_traits::construct(_dummy_allocator, dummy, key);
+        return dummy;
+    }
+
+    void destroy_dummy(link_t *dummy)
+    {
+        dummy_traits::destroy(_dummy_allocator, dummy);
+        dummy_traits::deallocate(_dummy_allocator, dummy, 1);
+    }
+
+// Instance data
+private:
+    node_allocator      _node_allocator;    ///< Allocator from which element nodes are obtained
+    dummy_allocator     _dummy_allocator;   ///< Allocator from which dummy nodes are obtained
+    EpochDomain        &_domain;            ///< Reclaims removed nodes
+    Hash                _hash;              ///< Hash function for the elements
+    KeyEqual            _equal;             ///< Equality of the elements
+    link_t              _head{0};           ///< Dummy node of bucket 0, heading the list
+    std::atomic<size_t> _bucket_count{2};   ///< Number of buckets in use
+    std::atomic<size_t> _count{0};          ///< Number of elements in the set
+
+    /// Segments of pointers to the buckets' dummy nodes
+    std::atomic<std::atomic<link_t *> *>    _segments[segment_count]{};
+};
+
+#endif // INC_SPLIT_ORDERED_HASH_SET
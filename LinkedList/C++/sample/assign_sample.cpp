@@ -0,0 +1,208 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <numeric>
+#include <vector>
+
+#include "../SingleLinkedList.h"
+#include "../DoubleLinkedList.h"
+
+namespace {
+
+constexpr size_t    element_count = 100000;
+constexpr int       refresh_count = 50;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+template<typename List>
+bool holds(const List &list, const std::vector<int> &values)
+{
+    size_t  index{0};
+
+    for (auto *node = list.head(); node != nullptr; node = node->next(), ++index)
+    {
+        if (index == values.size() || node->data() != values[index])
+            return false;
+    }
+
+    return index == values.size() && list.size() == values.size();
+}
+
+template<typename List>
+void benchmark(const char *title)
+{
+    // Refreshes alternate between slightly longer and slightly shorter
+    // contents, so that assign both adds and frees some nodes.
+    std::vector<int>    longer(element_count + element_count / 10);
+    std::vector<int>    shorter(element_count - element_count / 10);
+
+    std::iota(longer.begin(), longer.end(), 0);
+    std::iota(shorter.begin(), shorter.end(), 1000000);
+
+    std::cout << title << '\n';
+
+    List    list;
+    bool    correct{true};
+    auto    then{clock_type::now()};
+
+    for (int r = 0; r < refresh_count; ++r)
+    {
+        const auto &values{r % 2 ? shorter : longer};
+
+        list.erase();
+        for (int value : values)
+            list.append(value);
+    }
+    std::cout << "  erase and append:   " << std::setw(6) << elapsed_ms(then) << " ms\n";
+    correct = correct && holds(list, shorter);
+
+    then = clock_type::now();
+    for (int r = 0; r < refresh_count; ++r)
+    {
+        const auto &values{r % 2 ? shorter : longer};
+
+        list.assign(values.begin(), values.end());
+    }
+    std::cout << "  assign:             " << std::setw(6) << elapsed_ms(then) << " ms\n";
+    correct = correct && holds(list, shorter);
+
+    list.assign(longer.begin(), longer.end());
+
+    then = clock_type::now();
+    for (int r = 0; r < refresh_count; ++r)
+    {
+        List    copy;
+
+        for (auto *node = list.head(); node != nullptr; node = node->next())
+            copy.append(node->data());
+        correct = correct && copy.size() == list.size();
+    }
+    std::cout << "  copy by append:     " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    for (int r = 0; r < refresh_count; ++r)
+    {
+        List    copy{list.clone()};
+
+        correct = correct && copy.size() == list.size();
+    }
+    std::cout << "  clone:              " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    // A clone can be changed like any other list.
+    List    copy{list.clone()};
+
+    correct = correct && holds(copy, longer);
+    copy.assign(shorter.begin(), shorter.end());
+    correct = correct && holds(copy, shorter);
+    while (!copy.is_empty())
+        copy.remove(copy.head());
+    copy.append(1);
+    correct = correct && copy.size() == 1;
+
+    if (!correct)
+        std::cout << "  The contents are wrong!\n";
+}
+
+// Move every node of a clone into another list. The clone's nodes share
+// one block, so each is copied into a node of its own as it is moved.
+bool splice_from_clone()
+{
+    DoubleLinkedList<int>   list;
+    DoubleLinkedList<int>   target;
+    std::vector<int>        values(16);
+
+    std::iota(values.begin(), values.end(), 0);
+    for (int value : values)
+        list.append(value);
+
+    DoubleLinkedList<int>   copy{list.clone()};
+
+    while (!copy.is_empty())
+        target.splice(nullptr, copy, copy.head());
+
+    return holds(target, values) && copy.is_empty();
+}
+
+// Assign a clone to a list that already holds other values, and keep
+// clones in a vector, which moves them as it grows.
+template<typename List>
+bool assign_clone()
+{
+    List                list;
+    List                target;
+    std::vector<int>    values(16);
+
+    std::iota(values.begin(), values.end(), 0);
+    for (int value : values)
+        list.append(value);
+    for (int value = 100; value < 110; ++value)
+        target.append(value);
+
+    target = list.clone();
+
+    bool    correct{holds(target, values) && holds(list, values)};
+
+    target.remove(target.head());
+    target.append(16);
+    correct = correct && target.size() == values.size();
+
+    std::vector<List>   copies;
+
+    for (int c = 0; c < 8; ++c)
+        copies.push_back(list.clone());
+    for (const auto &copy : copies)
+        correct = correct && holds(copy, values);
+
+    return correct;
+}
+
+// Move-assign between lists whose allocators draw from different memory
+// resources, so the nodes must be copied rather than taken.
+bool assign_across_resources()
+{
+    std::pmr::monotonic_buffer_resource     first;
+    std::pmr::monotonic_buffer_resource     second;
+    pmr::DoubleLinkedList<int>              list{&first};
+    pmr::DoubleLinkedList<int>              target{&second};
+    std::vector<int>                        values(16);
+
+    std::iota(values.begin(), values.end(), 0);
+    for (int value : values)
+        list.append(value);
+    target.append(-1);
+
+    target = list.clone();
+
+    return holds(target, values) && holds(list, values)
+        && target.get_allocator().resource() == &second;
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << refresh_count << " refreshes of a list of about " << element_count
+              << " elements\n\n";
+
+    benchmark<SingleLinkedList<int>>("SingleLinkedList");
+    std::cout << '\n';
+    benchmark<DoubleLinkedList<int>>("DoubleLinkedList");
+
+    if (!splice_from_clone())
+        std::cout << "Splicing from a clone went wrong!\n";
+    if (!assign_clone<SingleLinkedList<int>>() || !assign_clone<DoubleLinkedList<int>>())
+        std::cout << "Assigning a clone went wrong!\n";
+    if (!assign_across_resources())
+        std::cout << "Assigning across memory resources went wrong!\n";
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../SingleLinkedList.h"
+#include "../DoubleLinkedList.h"
+#include "../ListBatch.h"
+
+namespace {
+
+constexpr size_t    list_count = 4000;
+constexpr int       list_length = 500;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+template<typename List>
+void benchmark(const char *name)
+{
+    // Appending to the lists in turn interleaves their nodes in memory, so
+    // following any one list skips over the nodes of the others.
+    std::vector<std::unique_ptr<List>>  storage;
+
+    for (size_t i = 0; i < list_count; ++i)
+        storage.push_back(std::make_unique<List>());
+    for (int value = 0; value < list_length; ++value)
+        for (auto &list : storage)
+            list->append(value);
+
+    // One lookup per list, in random order, for a value that is present
+    // three times in four.
+    std::mt19937                        random{2019};
+    std::uniform_int_distribution<int>  pick_list(0, list_count - 1);
+    std::uniform_int_distribution<int>  pick_value(0, list_length * 4 / 3);
+    std::vector<int>                    keys;
+    std::vector<List *>                 chosen;
+
+    for (size_t i = 0; i < list_count * 4; ++i)
+    {
+        keys.push_back(pick_value(random));
+        chosen.push_back(storage[pick_list(random)].get());
+    }
+
+    std::vector<const List *>           lists(chosen.begin(), chosen.end());
+
+    std::cout << '\n' << name << ": " << keys.size() << " lookups in "
+              << list_count << " lists of " << list_length << " nodes\n";
+
+    auto then = clock_type::now();
+    std::vector<typename List::node_t *>    expected;
+    for (size_t i = 0; i < keys.size(); ++i)
+        expected.push_back(chosen[i]->find(keys[i]));
+    std::cout << "  find, one key at a time:   " << elapsed_ms(then) << " ms\n";
+
+    for (size_t width : {1, 4, 8, 16})
+    {
+        then = clock_type::now();
+        auto results = find_many(keys, lists, width);
+        auto time = elapsed_ms(then);
+
+        std::cout << "  find_many, " << width << (width < 10 ? " " : "") << " in flight:  "
+                  << time << " ms" << (results == expected ? "" : " (WRONG RESULTS!)") << '\n';
+    }
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    benchmark<SingleLinkedList<int>>("SingleLinkedList");
+    benchmark<DoubleLinkedList<int>>("DoubleLinkedList");
+}
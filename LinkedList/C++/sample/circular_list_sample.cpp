@@ -0,0 +1,88 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../DoubleLinkedList.h"
+#include "../CircularDoubleLinkedList.h"
+
+namespace {
+
+constexpr int   operation_count = 5000000;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Apply a random mix of insertions and removals at random positions to a
+// list kept at about the given length, returning the elapsed time. The
+// positions are chosen from a table of the list's nodes, so no time is
+// spent searching. Every list sees the same sequence of operations.
+template<typename List>
+long long run(size_t length, int insert_percent)
+{
+    using node_pointer = typename List::node_t *;
+
+    List                                list;
+    std::vector<node_pointer>           nodes;
+    std::mt19937                        random{2019};
+    std::uniform_int_distribution<int>  pick_percent(0, 99);
+
+    for (size_t i = 0; i < length; ++i)
+        nodes.push_back(list.append(static_cast<int>(i)));
+
+    auto then = clock_type::now();
+    for (int i = 0; i < operation_count; ++i)
+    {
+        // Keep the list near the chosen length whatever the mix.
+        bool insert = nodes.empty()
+                      || (nodes.size() < 2 * length && pick_percent(random) < insert_percent);
+        size_t at = nodes.empty() ? 0 : random() % nodes.size();
+
+        if (insert)
+        {
+            if (nodes.empty())
+                nodes.push_back(list.append(i));
+            else if (i & 1)
+                nodes.push_back(list.insert_after(i, nodes[at]));
+            else
+                nodes.push_back(list.insert_before(i, nodes[at]));
+        }
+        else
+        {
+            list.remove(nodes[at]);
+            nodes[at] = nodes.back();
+            nodes.pop_back();
+        }
+    }
+    auto time = elapsed_ms(then);
+
+    if (list.size() != nodes.size())
+        std::cout << "  The list has the wrong size!\n";
+
+    return time;
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    std::cout << operation_count << " random insertions and removals\n";
+
+    for (size_t length : {4, 64, 10000})
+    {
+        std::cout << "\nLists of about " << length << " nodes\n";
+        for (int insert_percent : {50, 30})
+        {
+            std::cout << "  " << insert_percent << "% inserts: DoubleLinkedList "
+                      << run<DoubleLinkedList<int>>(length, insert_percent)
+                      << " ms, CircularDoubleLinkedList "
+                      << run<CircularDoubleLinkedList<int>>(length, insert_percent) << " ms\n";
+        }
+    }
+}
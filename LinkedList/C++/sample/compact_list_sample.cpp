@@ -0,0 +1,130 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <iostream>
+
+#include "../DoubleLinkedList.h"
+#include "../CompactDoubleLinkedList.h"
+
+namespace {
+
+constexpr int element_count = 10000000;
+
+// Helper function to display the time elapsed since a starting point.
+void print_elapsed(const char *what, std::chrono::high_resolution_clock::time_point then)
+{
+    auto now = std::chrono::high_resolution_clock::now();
+
+    std::cout << "  " << what << " took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+              << " milliseconds\n";
+}
+
+void benchmark_double_linked_list()
+{
+    std::cout << "DoubleLinkedList<int>, " << element_count << " elements\n";
+
+    DoubleLinkedList<int>   list;
+
+    auto then = std::chrono::high_resolution_clock::now();
+    for (int i=0; i < element_count; ++i)
+        list.append(i);
+    print_elapsed("appending", then);
+
+    // Each node is a separate heap allocation; the allocator's own per-block
+    // overhead is not included here.
+    std::cout << "  footprint is about "
+              << sizeof(list) + list.size() * sizeof(DoubleLinkedList<int>::node_t)
+              << " bytes (" << sizeof(DoubleLinkedList<int>::node_t) << " bytes per node)\n";
+
+    then = std::chrono::high_resolution_clock::now();
+    long long sum = 0;
+    for (auto *node = list.head(); node; node = node->next())
+        sum += node->data();
+    for (auto *node = list.tail(); node; node = node->prev())
+        sum -= node->data();
+    print_elapsed("traversing forward and backward", then);
+
+    then = std::chrono::high_resolution_clock::now();
+    auto *missing = list.find(-1);
+    print_elapsed("an unsuccessful find", then);
+
+    then = std::chrono::high_resolution_clock::now();
+    for (auto *node = list.head(); node; )
+    {
+        node = list.remove(node);
+        if (node)
+            node = node->next();
+    }
+    print_elapsed("removing every other node", then);
+
+    then = std::chrono::high_resolution_clock::now();
+    list.erase();
+    print_elapsed("erasing", then);
+
+    if (sum != 0 || missing != nullptr)
+        std::cout << "Unexpected results!\n";
+}
+
+void benchmark_compact_double_linked_list()
+{
+    using list_t = CompactDoubleLinkedList<int>;
+
+    std::cout << "CompactDoubleLinkedList<int>, " << element_count << " elements\n";
+
+    list_t  list;
+
+    auto then = std::chrono::high_resolution_clock::now();
+    for (int i=0; i < element_count; ++i)
+        list.append(i);
+    print_elapsed("appending", then);
+
+    std::cout << "  footprint is " << list.memory_footprint()
+              << " bytes (pool capacity grows geometrically)\n";
+
+    list.erase();
+    list.reserve(element_count);
+    then = std::chrono::high_resolution_clock::now();
+    for (int i=0; i < element_count; ++i)
+        list.append(i);
+    print_elapsed("appending into a reserved pool", then);
+
+    std::cout << "  footprint is " << list.memory_footprint() << " bytes\n";
+
+    then = std::chrono::high_resolution_clock::now();
+    long long sum = 0;
+    for (auto node = list.head(); node != list_t::npos; node = list.next(node))
+        sum += list.data(node);
+    for (auto node = list.tail(); node != list_t::npos; node = list.prev(node))
+        sum -= list.data(node);
+    print_elapsed("traversing forward and backward", then);
+
+    then = std::chrono::high_resolution_clock::now();
+    auto missing = list.find(-1);
+    print_elapsed("an unsuccessful find", then);
+
+    then = std::chrono::high_resolution_clock::now();
+    for (auto node = list.head(); node != list_t::npos; )
+    {
+        node = list.remove(node);
+        if (node != list_t::npos)
+            node = list.next(node);
+    }
+    print_elapsed("removing every other node", then);
+
+    then = std::chrono::high_resolution_clock::now();
+    list.erase();
+    print_elapsed("erasing", then);
+
+    if (sum != 0 || missing != list_t::npos)
+        std::cout << "Unexpected results!\n";
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    benchmark_double_linked_list();
+    std::cout << '\n';
+    benchmark_compact_double_linked_list();
+}
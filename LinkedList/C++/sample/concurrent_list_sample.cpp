@@ -0,0 +1,177 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../DoubleLinkedList.h"
+#include "../ConcurrentDoubleLinkedList.h"
+
+namespace {
+
+constexpr int   key_range = 2000;           // the list holds about half of these
+
+using clock_type = std::chrono::high_resolution_clock;
+
+double elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration<double, std::milli>(clock_type::now() - then).count();
+}
+
+// A DoubleLinkedList shared by guarding every operation with one mutex.
+class CoarseList
+{
+public:
+    bool contains(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _list.find(key) != nullptr;
+    }
+
+    void toggle(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto *node = _list.find(key);
+
+        if (node)
+            _list.remove(node);
+        else
+            _list.append(key);
+    }
+
+    void append(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _list.append(key);
+    }
+
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _list.size();
+    }
+
+private:
+    std::mutex              _mutex;
+    DoubleLinkedList<int>   _list;
+};
+
+// The same operations on a ConcurrentDoubleLinkedList.
+class FineList
+{
+public:
+    bool contains(int key)
+    {
+        return _list.contains(key);
+    }
+
+    void toggle(int key)
+    {
+        if (!_list.remove(key))
+            _list.append(key);
+    }
+
+    void append(int key)
+    {
+        _list.append(key);
+    }
+
+    size_t size()
+    {
+        return _list.size();
+    }
+
+private:
+    ConcurrentDoubleLinkedList<int> _list;
+};
+
+// Run a fixed number of operations, divided among the threads, of which the
+// given percentage only read the list. Writes remove a key if it is present
+// and append it otherwise, which keeps the length of the list steady.
+template<typename List>
+double run(unsigned threads, int read_percent, int operations)
+{
+    List    list;
+
+    for (int key = 0; key < key_range; key += 2)
+        list.append(key);
+
+    auto work = [&](unsigned seed)
+    {
+        std::mt19937                        random{seed};
+        std::uniform_int_distribution<int>  pick_key(0, key_range - 1);
+        std::uniform_int_distribution<int>  pick_percent(0, 99);
+        int                                 found = 0;
+
+        for (int i = 0; i < operations / static_cast<int>(threads); ++i)
+        {
+            int key = pick_key(random);
+
+            if (pick_percent(random) < read_percent)
+                found += list.contains(key);
+            else
+                list.toggle(key);
+        }
+
+        return found;
+    };
+
+    auto then = clock_type::now();
+    std::vector<std::thread>    pool;
+    for (unsigned t = 0; t < threads; ++t)
+        pool.emplace_back(work, t + 1);
+    for (auto &thread : pool)
+        thread.join();
+
+    return elapsed_ms(then);
+}
+
+void demonstrate_list()
+{
+    ConcurrentDoubleLinkedList<int> list;
+
+    list.append(2);
+    list.prepend(1);
+    list.append(5);
+    list.insert_after(3, 2);
+    list.insert_before(4, 5);
+    list.remove(1);
+
+    std::cout << "List of " << list.size() << " elements:";
+    list.for_each([](int value) { std::cout << ' ' << value; });
+    std::cout << "\nContains 3: " << std::boolalpha << list.contains(3)
+              << ", contains 1: " << list.contains(1) << '\n';
+}
+
+} // end of anonymous namespace
+
+// Usage: concurrent_list_sample_cpp [operations [most threads]]
+int main(int argc, char *argv[])
+{
+    int         operations = argc > 1 ? std::atoi(argv[1]) : 20000;
+    unsigned    max_threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 8;
+
+    demonstrate_list();
+
+    std::cout << "\nThis machine reports " << std::thread::hardware_concurrency()
+              << " hardware threads\n"
+              << operations << " operations on a list of about " << key_range / 2
+              << " elements\n";
+
+    for (int read_percent : {100, 90, 50})
+    {
+        std::cout << '\n' << read_percent << "% reads\n";
+        for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+        {
+            double coarse = run<CoarseList>(threads, read_percent, operations);
+            double fine = run<FineList>(threads, read_percent, operations);
+
+            std::cout << "  " << threads << " threads: single mutex " << coarse
+                      << " ms, lock coupling " << fine << " ms\n";
+        }
+    }
+}
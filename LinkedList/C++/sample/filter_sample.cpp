@@ -0,0 +1,127 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../SingleLinkedList.h"
+#include "../DoubleLinkedList.h"
+
+namespace {
+
+constexpr int       element_count = 20000;
+constexpr size_t    lookup_count = 20000;
+constexpr double    miss_proportion = 0.9;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// The list holds the even numbers below twice element_count. A lookup of an
+// odd number, or of a number beyond the range, misses.
+std::vector<int> make_lookups()
+{
+    std::mt19937_64                     engine{2019};
+    std::uniform_int_distribution<int>  hit(0, element_count - 1);
+    std::uniform_int_distribution<int>  miss(0, 4 * element_count);
+    std::bernoulli_distribution         is_miss(miss_proportion);
+    std::vector<int>                    lookups(lookup_count);
+
+    for (auto &lookup : lookups)
+        lookup = is_miss(engine) ? miss(engine) | 1 : 2 * hit(engine);
+
+    return lookups;
+}
+
+template<typename List>
+size_t lookup_all(List &list, const std::vector<int> &lookups)
+{
+    size_t  found{0};
+
+    for (int key : lookups)
+        found += list.find(key) != nullptr;
+
+    return found;
+}
+
+void print_filter(const FilterStats &stats)
+{
+    std::cout << "    filter: " << stats.memory_bytes << " bytes, "
+              << stats.counter_count << " counters, "
+              << stats.hash_count << " hashes; "
+              << stats.rejected << " of " << stats.queries << " lookups rejected, "
+              << std::fixed << std::setprecision(2)
+              << 100.0 * stats.false_positive_rate() << "% false positives\n";
+}
+
+template<typename List>
+void benchmark(const char *title, const std::vector<int> &lookups)
+{
+    List    list;
+
+    for (int i = 0; i < element_count; ++i)
+        list.append(2 * i);
+
+    std::cout << title << '\n';
+
+    auto    then{clock_type::now()};
+    size_t  found{lookup_all(list, lookups)};
+
+    std::cout << "  find without filter: " << std::setw(6) << elapsed_ms(then)
+              << " ms, " << found << " found\n";
+
+    list.enable_filter(element_count);
+
+    then = clock_type::now();
+    found = lookup_all(list, lookups);
+    std::cout << "  find with filter:    " << std::setw(6) << elapsed_ms(then)
+              << " ms, " << found << " found\n";
+    print_filter(list.filter_stats());
+
+    // Removing every other element must keep the filter exact for the
+    // remaining elements and let it reject the removed ones again.
+    auto   *node{list.head()};
+
+    while (node != nullptr)
+    {
+        node = list.remove(node);
+        if (node != nullptr)
+            node = node->next();
+    }
+
+    List    reference;
+
+    for (auto *n = list.head(); n != nullptr; n = n->next())
+        reference.append(n->data());
+
+    then = clock_type::now();
+    found = lookup_all(list, lookups);
+    std::cout << "  after removing half: " << std::setw(6) << elapsed_ms(then)
+              << " ms, " << found << " found";
+    if (found != lookup_all(reference, lookups))
+        std::cout << " -- MISMATCH with the unfiltered list";
+    std::cout << '\n';
+    print_filter(list.filter_stats());
+}
+
+} // namespace
+
+int main()
+{
+    auto    lookups{make_lookups()};
+
+    std::cout << lookups.size() << " lookups in lists of " << element_count
+              << " elements, " << int(miss_proportion * 100) << "% of them misses\n\n";
+
+    benchmark<SingleLinkedList<int>>("SingleLinkedList", lookups);
+    std::cout << '\n';
+    benchmark<DoubleLinkedList<int>>("DoubleLinkedList", lookups);
+
+    return 0;
+}
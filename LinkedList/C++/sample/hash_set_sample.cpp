@@ -0,0 +1,163 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "../SplitOrderedHashSet.h"
+
+namespace {
+
+using clock_type = std::chrono::high_resolution_clock;
+
+double elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration<double, std::milli>(clock_type::now() - then).count();
+}
+
+// A std::unordered_set shared by guarding every operation with one mutex.
+class LockedSet
+{
+public:
+    bool contains(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _set.count(key) != 0;
+    }
+
+    bool insert(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _set.insert(key).second;
+    }
+
+    bool remove(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _set.erase(key) != 0;
+    }
+
+private:
+    std::mutex              _mutex;
+    std::unordered_set<int> _set;
+};
+
+// Run a fixed number of operations, divided among the threads, of which the
+// given percentage are lookups. The rest remove a key if it is present and
+// insert it otherwise, which keeps the size of the set steady.
+template<typename Set>
+double run(Set &set, int key_range, unsigned threads, int read_percent, int operations)
+{
+    std::atomic<long>   found{0};
+
+    auto work = [&](unsigned seed)
+    {
+        std::mt19937                        random{seed};
+        std::uniform_int_distribution<int>  pick_key(0, key_range - 1);
+        std::uniform_int_distribution<int>  pick_percent(0, 99);
+        long                                hits = 0;
+
+        for (int i = 0; i < operations / static_cast<int>(threads); ++i)
+        {
+            int key = pick_key(random);
+
+            if (pick_percent(random) < read_percent)
+                hits += set.contains(key);
+            else if (!set.remove(key))
+                set.insert(key);
+        }
+
+        found += hits;
+    };
+
+    auto then = clock_type::now();
+    std::vector<std::thread>    pool;
+    for (unsigned t = 0; t < threads; ++t)
+        pool.emplace_back(work, t + 1);
+    for (auto &thread : pool)
+        thread.join();
+
+    // About half of the lookups should succeed.
+    if (read_percent > 0 && found == 0)
+        std::cout << "  No lookups succeeded!\n";
+
+    return elapsed_ms(then);
+}
+
+template<typename Set>
+void fill(Set &set, int key_range)
+{
+    for (int key = 0; key < key_range; key += 2)
+        set.insert(key);
+}
+
+// Check that the set's count matches the elements that can be visited.
+bool consistent(const SplitOrderedHashSet<int> &set)
+{
+    size_t  count = 0;
+
+    set.for_each([&count](int) { ++count; });
+    return count == set.size();
+}
+
+// Fill a set from empty, so that the table doubles many times.
+void demonstrate_growth(int count)
+{
+    SplitOrderedHashSet<int>    set;
+
+    auto then = clock_type::now();
+    for (int key = 0; key < count; ++key)
+        set.insert(key);
+    double fill_time = elapsed_ms(then);
+
+    int missing = 0;
+    for (int key = 0; key < count; ++key)
+        missing += !set.contains(key);
+
+    std::cout << "Inserting " << count << " keys into an empty set took " << fill_time
+              << " ms, ending with " << set.bucket_count() << " buckets"
+              << (missing || !consistent(set) ? " (KEYS MISSING!)" : "") << '\n';
+}
+
+} // end of anonymous namespace
+
+// Usage: hash_set_sample_cpp [operations [most threads [key range]]]
+int main(int argc, char *argv[])
+{
+    int         operations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    unsigned    max_threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 8;
+    int         key_range = argc > 3 ? std::atoi(argv[3]) : 100000;
+
+    demonstrate_growth(key_range);
+
+    std::cout << "\nThis machine reports " << std::thread::hardware_concurrency()
+              << " hardware threads\n"
+              << operations << " operations on a set of about " << key_range / 2
+              << " elements\n";
+
+    for (int read_percent : {100, 90, 50})
+    {
+        std::cout << '\n' << read_percent << "% lookups\n";
+        for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+        {
+            LockedSet                   locked;
+            SplitOrderedHashSet<int>    lock_free;
+
+            fill(locked, key_range);
+            fill(lock_free, key_range);
+
+            double locked_time = run(locked, key_range, threads, read_percent, operations);
+            double lock_free_time = run(lock_free, key_range, threads, read_percent, operations);
+
+            std::cout << "  " << threads << " threads: mutex and unordered_set " << locked_time
+                      << " ms, split-ordered " << lock_free_time << " ms"
+                      << (consistent(lock_free) ? "" : " (SET IS INCONSISTENT!)") << '\n';
+        }
+    }
+}
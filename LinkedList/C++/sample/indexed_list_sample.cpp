@@ -0,0 +1,157 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../DoubleLinkedList.h"
+#include "../IndexedList.h"
+
+namespace {
+
+constexpr int       element_count = 200000;
+constexpr size_t    page_size = 20;
+constexpr size_t    page_count = 2000;
+constexpr size_t    edit_count = 2000;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Walk a DoubleLinkedList to the node at a position, the only way it has.
+DoubleLinkedList<int>::node_t *walk_to(const DoubleLinkedList<int> &list, size_t index)
+{
+    auto   *node{list.head()};
+
+    while (index-- > 0)
+        node = node->next();
+
+    return node;
+}
+
+// Apply random insertions and removals by position to an IndexedList and to
+// a vector, and check that they agree throughout.
+bool check_against_vector()
+{
+    IndexedList<int>    list;
+    std::vector<int>    reference;
+    std::mt19937_64     engine{2019};
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        if (reference.empty() || engine() % 3 != 0)
+        {
+            size_t  index{size_t(engine() % (reference.size() + 1))};
+
+            list.insert_at(index, i);
+            reference.insert(reference.begin() + long(index), i);
+        }
+        else
+        {
+            size_t  index{size_t(engine() % reference.size())};
+
+            list.erase_at(index);
+            reference.erase(reference.begin() + long(index));
+        }
+
+        if (list.size() != reference.size())
+            return false;
+    }
+
+    size_t  index{0};
+
+    for (auto *node = list.head(); node != nullptr; node = node->next(), ++index)
+    {
+        if (node->data() != reference[index] || list.at(index) != reference[index]
+            || list.index_of(node) != index || list.node_at(index) != node)
+            return false;
+    }
+
+    for (auto *node = list.tail(); node != nullptr; node = node->prev())
+    {
+        if (node->data() != reference[--index])
+            return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << "IndexedList agrees with std::vector: "
+              << (check_against_vector() ? "yes" : "NO") << "\n\n";
+
+    DoubleLinkedList<int>   list;
+    IndexedList<int>        indexed;
+
+    for (int i = 0; i < element_count; ++i)
+    {
+        list.append(i);
+        indexed.append(i);
+    }
+
+    std::mt19937_64                         engine{42};
+    std::uniform_int_distribution<size_t>   page(0, element_count / page_size - 1);
+    std::vector<size_t>                     pages(page_count);
+
+    for (auto &p : pages)
+        p = page(engine);
+
+    std::cout << page_count << " random pages of " << page_size
+              << " elements from lists of " << element_count << '\n';
+
+    long long   sum{0};
+    auto        then{clock_type::now()};
+
+    for (size_t p : pages)
+    {
+        auto   *node{walk_to(list, p * page_size)};
+
+        for (size_t i = 0; i < page_size; ++i, node = node->next())
+            sum += node->data();
+    }
+    std::cout << "  DoubleLinkedList:   " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    for (size_t p : pages)
+    {
+        auto   *node{indexed.node_at(p * page_size)};
+
+        for (size_t i = 0; i < page_size; ++i, node = node->next())
+            sum -= node->data();
+    }
+    std::cout << "  IndexedList:        " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    if (sum != 0)
+        std::cout << "  The pages differ!\n";
+
+    std::cout << edit_count << " insertions and removals at random positions\n";
+
+    std::uniform_int_distribution<size_t>   position(0, element_count - 1);
+
+    then = clock_type::now();
+    for (size_t i = 0; i < edit_count; ++i)
+    {
+        list.remove(walk_to(list, position(engine)));
+        list.insert_before(int(i), walk_to(list, position(engine)));
+    }
+    std::cout << "  DoubleLinkedList:   " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    for (size_t i = 0; i < edit_count; ++i)
+    {
+        indexed.erase_at(position(engine));
+        indexed.insert_at(position(engine), int(i));
+    }
+    std::cout << "  IndexedList:        " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    return 0;
+}
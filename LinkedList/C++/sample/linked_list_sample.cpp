@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <sstream>
 
 #include "../SingleLinkedList.h"
 #include "../DoubleLinkedList.h"
@@ -252,9 +253,80 @@ void test_doubly_linked_list()
               << " milliseconds\n";
 }
 
+void test_serialization()
+{
+    std::cout << "Testing serialization.\n";
+
+    SingleLinkedList<int>   int_list;
+    DoubleLinkedList<int>   copy;
+    std::stringstream       stream(std::ios::in | std::ios::out | std::ios::binary);
+
+    for (int i=0; i < 1000000; ++i)
+        int_list.append(i);
+
+    auto then = std::chrono::high_resolution_clock::now();
+    bool ok = int_list.serialize(stream);
+    auto now = std::chrono::high_resolution_clock::now();
+
+    std::cout << "serializing 1,000,000 elements took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+              << " milliseconds\n";
+
+    // The format is shared, so a list written from one kind of list can be
+    // read into the other.
+    then = std::chrono::high_resolution_clock::now();
+    ok = ok && copy.deserialize(stream);
+    now = std::chrono::high_resolution_clock::now();
+
+    std::cout << "deserializing 1,000,000 elements took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+              << " milliseconds\n";
+
+    if (ok && copy.size() == int_list.size() && copy.tail()->data() == int_list.tail()->data())
+        std::cout << "The deserialized list matches\n";
+    else
+        std::cout << "Serialization failed!\n";
+}
+
+void test_stats()
+{
+    std::cout << "Testing instrumentation counters.\n";
+#if !defined(DS_ENABLE_STATS)
+    std::cout << "Instrumentation is disabled; configure with -DENABLE_STATS=ON to collect counters.\n";
+#endif
+
+    SingleLinkedList<int>   single;
+    DoubleLinkedList<int>   dbl;
+
+    for (int i=0; i < 1000; ++i)
+    {
+        single.append(i);
+        dbl.append(i);
+    }
+
+    for (int i=0; i < 1000; i += 10)
+    {
+        single.find(i);
+        dbl.find(i);
+    }
+
+    // Removing nodes from a singly-linked list requires finding their
+    // predecessors, which the counters make visible.
+    for (int i=0; i < 100; ++i)
+        single.remove(single.tail());
+
+    single.stats().write_text(std::cout);
+    dbl.stats().write_json(std::cout);
+    std::cout << '\n';
+}
+
 int main()
 {
     test_singly_linked_list();
     std::cout << "\n\n";
     test_doubly_linked_list();
+    std::cout << "\n\n";
+    test_serialization();
+    std::cout << "\n\n";
+    test_stats();
 }
@@ -0,0 +1,162 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../SingleLinkedList.h"
+#include "../LockFreeOrderedList.h"
+
+namespace {
+
+constexpr int   key_range = 1000;           // the set holds about half of these
+
+using clock_type = std::chrono::high_resolution_clock;
+
+double elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration<double, std::milli>(clock_type::now() - then).count();
+}
+
+// A set kept in a SingleLinkedList, shared by guarding every operation with
+// one mutex.
+class LockedSet
+{
+public:
+    bool contains(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _list.find(key) != nullptr;
+    }
+
+    bool insert(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_list.find(key) != nullptr)
+            return false;
+        _list.prepend(key);
+        return true;
+    }
+
+    bool remove(int key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto *node = _list.find(key);
+
+        if (node == nullptr)
+            return false;
+        _list.remove(node);
+        return true;
+    }
+
+private:
+    std::mutex              _mutex;
+    SingleLinkedList<int>   _list;
+};
+
+// Run a fixed number of operations, divided among the threads, of which the
+// given percentage are lookups. The rest remove a key if it is present and
+// insert it otherwise, which keeps the size of the set steady.
+template<typename Set>
+double run(Set &set, unsigned threads, int read_percent, int operations)
+{
+    std::atomic<long>   found{0};
+
+    auto work = [&](unsigned seed)
+    {
+        std::mt19937                        random{seed};
+        std::uniform_int_distribution<int>  pick_key(0, key_range - 1);
+        std::uniform_int_distribution<int>  pick_percent(0, 99);
+        long                                hits = 0;
+
+        for (int i = 0; i < operations / static_cast<int>(threads); ++i)
+        {
+            int key = pick_key(random);
+
+            if (pick_percent(random) < read_percent)
+                hits += set.contains(key);
+            else if (!set.remove(key))
+                set.insert(key);
+        }
+
+        found += hits;
+    };
+
+    auto then = clock_type::now();
+    std::vector<std::thread>    pool;
+    for (unsigned t = 0; t < threads; ++t)
+        pool.emplace_back(work, t + 1);
+    for (auto &thread : pool)
+        thread.join();
+
+    // About half of the lookups should succeed.
+    if (read_percent > 0 && found == 0)
+        std::cout << "  No lookups succeeded!\n";
+
+    return elapsed_ms(then);
+}
+
+template<typename Set>
+void fill(Set &set)
+{
+    for (int key = 0; key < key_range; key += 2)
+        set.insert(key);
+}
+
+// Check that the set is still sorted and that its count matches its nodes.
+bool consistent(const LockFreeOrderedList<int> &set)
+{
+    size_t  count = 0;
+    int     last = -1;
+    bool    sorted = true;
+
+    set.for_each([&](int key)
+                 {
+                     sorted = sorted && key > last;
+                     last = key;
+                     ++count;
+                 });
+
+    return sorted && count == set.size();
+}
+
+} // end of anonymous namespace
+
+// Usage: lock_free_list_sample_cpp [operations [most threads]]
+int main(int argc, char *argv[])
+{
+    int         operations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    unsigned    max_threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 8;
+
+    std::cout << "This machine reports " << std::thread::hardware_concurrency()
+              << " hardware threads\n"
+              << operations << " operations on a set of about " << key_range / 2
+              << " elements\n";
+
+    for (int read_percent : {100, 90, 50})
+    {
+        std::cout << '\n' << read_percent << "% lookups\n";
+        for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+        {
+            LockedSet                   locked;
+            LockFreeOrderedList<int>    lock_free;
+
+            fill(locked);
+            fill(lock_free);
+
+            double locked_time = run(locked, threads, read_percent, operations);
+            double lock_free_time = run(lock_free, threads, read_percent, operations);
+
+            std::cout << "  " << threads << " threads: mutex " << locked_time
+                      << " ms, lock-free " << lock_free_time << " ms"
+                      << (consistent(lock_free) ? "" : " (SET IS INCONSISTENT!)") << '\n';
+        }
+    }
+
+    std::cout << "\nNodes awaiting reclamation: " << EpochDomain::shared().pending() << '\n';
+}
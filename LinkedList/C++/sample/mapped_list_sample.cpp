@@ -0,0 +1,193 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+
+#include "../SingleLinkedList.h"
+#include "../DoubleLinkedList.h"
+#include "../MappedList.h"
+
+namespace {
+
+constexpr int   element_count = 5000000;
+const char     *file_name = "mapped_list_sample.dat";
+
+// Helper function to display the time elapsed since a starting point.
+void print_elapsed(const char *what, std::chrono::high_resolution_clock::time_point then)
+{
+    auto now = std::chrono::high_resolution_clock::now();
+
+    std::cout << "  " << what << " took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+              << " milliseconds\n";
+}
+
+// Sum the data in a list, forcing every node to be visited.
+template<typename List>
+long long sum_list(const List &list)
+{
+    long long sum = 0;
+
+    for (auto *node = list.head(); node; node = node->next())
+        sum += node->data();
+
+    return sum;
+}
+
+struct Point
+{
+    int x;
+    int y;
+};
+
+bool operator==(const Point &lhs, const Point &rhs)
+{
+    return lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+void demonstrate_mapped_list()
+{
+    std::cout << "Saving a singly-linked list of points\n";
+
+    {
+        SingleLinkedList<Point> list;
+
+        list.append({1, 2});
+        list.append({3, 4});
+        list.append({5, 6});
+
+        if (!list.save(file_name))
+        {
+            std::cout << "Failed to save the list!\n";
+            return;
+        }
+    }
+
+    MappedList<Point>   mapped(file_name);
+
+    if (!mapped.is_open())
+    {
+        std::cout << "Failed to map the list!\n";
+        return;
+    }
+
+    std::cout << "The mapped list has " << mapped.size() << " nodes\n";
+    for (auto *node = mapped.tail(); node; node = node->prev())
+        std::cout << "Data = {" << node->data().x << ',' << node->data().y << "}\n";
+
+    auto *found = mapped.find({3, 4});
+    std::cout << ((found && found->next()->data() == Point{5, 6}) ? "Found {3,4}\n"
+                                                                   : "Failed to find {3,4}!\n");
+
+    // A file whose records are not the size of the requested type is rejected.
+    MappedList<char>    wrong_type(file_name);
+    std::cout << "Mapping the file as a list of char "
+              << (wrong_type.is_open() ? "unexpectedly succeeded!\n" : "was refused\n");
+}
+
+// Damage the links of a saved list and check that it is refused.
+void demonstrate_corrupt_file()
+{
+    {
+        SingleLinkedList<long long> list;
+
+        for (long long i = 0; i < 4; ++i)
+            list.append(i);
+        if (!list.save(file_name))
+        {
+            std::cout << "Failed to save the list!\n";
+            return;
+        }
+    }
+
+    // Each record is the data followed by the offsets to the next and
+    // previous records; point the second record's next link far outside
+    // the file.
+    using record_t = list_file::record<long long>;
+
+    const long          offset = static_cast<long>(list_file::records_offset<long long>()
+                                                   + sizeof(record_t) + sizeof(long long));
+    const std::int64_t  bad_link{std::int64_t{1} << 40};
+    std::FILE          *file = std::fopen(file_name, "r+b");
+
+    if (file == nullptr || std::fseek(file, offset, SEEK_SET) != 0
+        || std::fwrite(&bad_link, sizeof(bad_link), 1, file) != 1)
+    {
+        std::cout << "Failed to damage the file!\n";
+        if (file != nullptr)
+            std::fclose(file);
+        return;
+    }
+    std::fclose(file);
+
+    MappedList<long long>   corrupt(file_name);
+    std::cout << "Mapping a file with a damaged link "
+              << (corrupt.is_open() ? "unexpectedly succeeded!\n" : "was refused\n");
+}
+
+void benchmark_startup()
+{
+    std::cout << "\nStartup with a " << element_count << " element list\n";
+
+    {
+        DoubleLinkedList<int>   list;
+
+        for (int i = 0; i < element_count; ++i)
+            list.append(i);
+
+        auto then = std::chrono::high_resolution_clock::now();
+        bool saved = list.save(file_name);
+        print_elapsed("saving the list", then);
+
+        if (!saved)
+        {
+            std::cout << "Failed to save the list!\n";
+            return;
+        }
+    }
+
+    long long rebuilt_sum;
+    long long mapped_sum;
+
+    {
+        auto then = std::chrono::high_resolution_clock::now();
+        DoubleLinkedList<int>   list;
+        for (int i = 0; i < element_count; ++i)
+            list.append(i);
+        print_elapsed("rebuilding with append", then);
+
+        then = std::chrono::high_resolution_clock::now();
+        rebuilt_sum = sum_list(list);
+        print_elapsed("traversing the rebuilt list", then);
+    }
+
+    {
+        auto then = std::chrono::high_resolution_clock::now();
+        MappedList<int> list(file_name);
+        print_elapsed("mapping the saved list", then);
+
+        then = std::chrono::high_resolution_clock::now();
+        mapped_sum = sum_list(list);
+        print_elapsed("traversing the mapped list (first touch)", then);
+
+        then = std::chrono::high_resolution_clock::now();
+        mapped_sum = sum_list(list);
+        print_elapsed("traversing the mapped list again", then);
+    }
+
+    if (rebuilt_sum != mapped_sum)
+        std::cout << "The mapped list does not match the rebuilt list!\n";
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    demonstrate_mapped_list();
+    demonstrate_corrupt_file();
+    benchmark_startup();
+
+    std::remove(file_name);
+}
@@ -0,0 +1,172 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "../DoubleLinkedList.h"
+#include "../OrderMaintainedList.h"
+
+namespace {
+
+constexpr size_t    element_count = 100000;
+constexpr size_t    query_count = 2000;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Without labels, the only way to order two nodes is to walk from one and
+// see whether the other turns up.
+template<typename Node>
+bool walk_precedes(const Node *a, const Node *b)
+{
+    for (a = a->next(); a != nullptr; a = a->next())
+    {
+        if (a == b)
+            return true;
+    }
+
+    return false;
+}
+
+// Build a list by random insertions and removals, and check precedes
+// against the positions found by walking it.
+bool check_random_edits()
+{
+    using list_type = OrderMaintainedList<int>;
+
+    list_type                       list;
+    std::vector<list_type::node_t *> nodes;
+    std::mt19937_64                 engine{2019};
+
+    for (int i = 0; i < 50000; ++i)
+    {
+        unsigned    choice{unsigned(engine() % 8)};
+
+        if (nodes.empty() || choice == 0)
+        {
+            nodes.push_back(engine() % 2 ? list.prepend(i) : list.append(i));
+        }
+        else if (choice < 6)
+        {
+            auto   *where{nodes[engine() % nodes.size()]};
+
+            nodes.push_back(choice % 2 ? list.insert_after(i, where) : list.insert_before(i, where));
+        }
+        else
+        {
+            size_t  victim{size_t(engine() % nodes.size())};
+
+            list.remove(nodes[victim]);
+            nodes[victim] = nodes.back();
+            nodes.pop_back();
+        }
+    }
+
+    std::unordered_map<const list_type::node_t *, size_t>   position;
+    size_t                                                  index{0};
+
+    for (auto *node = list.head(); node != nullptr; node = node->next())
+        position[node] = index++;
+
+    if (index != list.size() || index != nodes.size())
+        return false;
+
+    for (int i = 0; i < 200000; ++i)
+    {
+        auto   *a{nodes[engine() % nodes.size()]};
+        auto   *b{nodes[engine() % nodes.size()]};
+
+        if (list.precedes(a, b) != (position[a] < position[b]))
+            return false;
+    }
+
+    return true;
+}
+
+// Insert repeatedly at one place, which uses up the labels there fastest,
+// and report how many labels were reassigned per insertion. The insertion
+// is given a cursor, starting at the head, that it may move.
+template<typename Insert>
+void relabel_cost(const char *name, Insert insert)
+{
+    OrderMaintainedList<int>    list;
+    auto                       *cursor{list.append(0)};
+
+    list.append(1);
+
+    auto    then{clock_type::now()};
+
+    for (int i = 0; i < int(element_count * 10); ++i)
+        insert(list, cursor, i);
+
+    std::cout << "  " << std::left << std::setw(28) << name << std::right
+              << std::setw(6) << elapsed_ms(then) << " ms, "
+              << std::fixed << std::setprecision(2)
+              << double(list.relabel_count()) / double(list.size()) << " relabels per insertion\n";
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << "precedes agrees with list positions after random edits: "
+              << (check_random_edits() ? "yes" : "NO") << "\n\n";
+
+    std::cout << element_count * 10 << " insertions\n";
+    relabel_cost("append", [](auto &list, auto *&, int i) { list.append(i); });
+    relabel_cost("prepend", [](auto &list, auto *&, int i) { list.prepend(i); });
+    relabel_cost("always after the same node", [](auto &list, auto *&cursor, int i)
+                 {
+                     list.insert_after(i, cursor);
+                 });
+    relabel_cost("after the previous insertion", [](auto &list, auto *&cursor, int i)
+                 {
+                     cursor = list.insert_after(i, cursor);
+                 });
+
+    DoubleLinkedList<int>                   plain;
+    OrderMaintainedList<int>                labelled;
+    std::vector<DoubleLinkedList<int>::node_t *>    plain_nodes;
+    std::vector<OrderMaintainedList<int>::node_t *> labelled_nodes;
+
+    for (size_t i = 0; i < element_count; ++i)
+    {
+        plain_nodes.push_back(plain.append(int(i)));
+        labelled_nodes.push_back(labelled.append(int(i)));
+    }
+
+    std::mt19937_64     engine{42};
+    std::vector<size_t> queries(2 * query_count);
+
+    for (auto &q : queries)
+        q = size_t(engine() % element_count);
+
+    std::cout << '\n' << query_count << " precedence queries in lists of "
+              << element_count << " elements\n";
+
+    size_t  before{0};
+    auto    then{clock_type::now()};
+
+    for (size_t i = 0; i < query_count; ++i)
+        before += walk_precedes(plain_nodes[queries[2 * i]], plain_nodes[queries[2 * i + 1]]);
+    std::cout << "  DoubleLinkedList walk:    " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    for (size_t i = 0; i < query_count; ++i)
+        before -= labelled.precedes(labelled_nodes[queries[2 * i]], labelled_nodes[queries[2 * i + 1]]);
+    std::cout << "  OrderMaintainedList:      " << std::setw(6) << elapsed_ms(then) << " ms\n";
+
+    if (before != 0)
+        std::cout << "  The answers differ!\n";
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../SingleLinkedList.h"
+#include "../DoubleLinkedList.h"
+
+namespace {
+
+constexpr int       key_count = 1000;
+constexpr size_t    lookup_count = 1000000;
+constexpr double    zipf_exponent = 1.0;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Draw keys so that the k-th most popular key is drawn in proportion to
+// 1 / k^s. The popular keys are not the first ones inserted.
+std::vector<int> zipf_lookups(const std::vector<int> &keys)
+{
+    std::vector<double> cumulative(keys.size());
+    double              total{0.0};
+
+    for (size_t k = 0; k < keys.size(); ++k)
+        cumulative[k] = total += 1.0 / std::pow(double(k + 1), zipf_exponent);
+
+    std::mt19937_64                         engine{42};
+    std::uniform_real_distribution<double>  uniform(0.0, total);
+    std::vector<int>                        lookups(lookup_count);
+
+    for (auto &lookup : lookups)
+    {
+        auto    rank{std::lower_bound(cumulative.begin(), cumulative.end(), uniform(engine))
+                     - cumulative.begin()};
+
+        lookup = keys[std::min(size_t(rank), keys.size() - 1)];
+    }
+
+    return lookups;
+}
+
+// The number of nodes a search for a value visits.
+template<typename List>
+size_t probes(const List &list, int value)
+{
+    size_t  count{0};
+
+    for (auto *node = list.head(); node != nullptr; node = node->next())
+    {
+        ++count;
+        if (node->data() == value)
+            break;
+    }
+
+    return count;
+}
+
+template<typename List, typename... Policy>
+void run(const char *name, const std::vector<int> &inserted,
+         const std::vector<int> &lookups, Policy... policy)
+{
+    size_t      found{0};
+    size_t      visited{0};
+
+    // Time the lookups on one list...
+    {
+        List    list;
+
+        for (int key : inserted)
+            list.append(key);
+
+        auto    then{clock_type::now()};
+
+        for (int key : lookups)
+            found += list.find(key, policy...) != nullptr;
+
+        std::cout << "  " << std::left << std::setw(18) << name
+                  << std::right << std::setw(6) << elapsed_ms(then) << " ms";
+    }
+
+    // ...and count the nodes they visit on another, outside the timing.
+    {
+        List    list;
+
+        for (int key : inserted)
+            list.append(key);
+
+        for (int key : lookups)
+        {
+            visited += probes(list, key);
+            list.find(key, policy...);
+        }
+    }
+
+    std::cout << std::setw(10) << std::fixed << std::setprecision(1)
+              << double(visited) / double(lookups.size()) << " nodes per find";
+    if (found != lookups.size())
+        std::cout << "  (missed " << lookups.size() - found << ")";
+    std::cout << '\n';
+}
+
+template<typename List>
+void benchmark(const char *title, const std::vector<int> &inserted,
+               const std::vector<int> &lookups)
+{
+    std::cout << title << '\n';
+    run<List>("find", inserted, lookups);
+    run<List>("move_to_front", inserted, lookups, move_to_front);
+    run<List>("transpose", inserted, lookups, transpose);
+    run<List>("frequency_count", inserted, lookups, frequency_count);
+}
+
+} // namespace
+
+int main()
+{
+    std::vector<int>    keys(key_count);
+
+    std::iota(keys.begin(), keys.end(), 0);
+
+    // The popularity of a key is unrelated to where it was inserted.
+    std::vector<int>    inserted{keys};
+    std::vector<int>    by_popularity{keys};
+
+    std::shuffle(inserted.begin(), inserted.end(), std::mt19937_64{2019});
+    std::shuffle(by_popularity.begin(), by_popularity.end(), std::mt19937_64{2026});
+
+    auto    lookups{zipf_lookups(by_popularity)};
+
+    std::cout << lookups.size() << " Zipf-distributed lookups (s = " << zipf_exponent
+              << ") among " << key_count << " keys\n\n";
+
+    benchmark<SingleLinkedList<int>>("SingleLinkedList", inserted, lookups);
+    std::cout << '\n';
+    benchmark<DoubleLinkedList<int>>("DoubleLinkedList", inserted, lookups);
+
+    return 0;
+}
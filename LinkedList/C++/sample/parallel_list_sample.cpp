@@ -0,0 +1,131 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+
+#include "../SingleLinkedList.h"
+#include "../DoubleLinkedList.h"
+#include "../ListSegments.h"
+
+namespace {
+
+using clock_type = std::chrono::high_resolution_clock;
+
+double elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration<double, std::milli>(clock_type::now() - then).count();
+}
+
+// Time the parallel operations on a list of the given size for each thread
+// count, reporting the speedup over a single thread.
+void benchmark(long count, unsigned max_threads)
+{
+    SingleLinkedList<long>  list;
+
+    for (long i = 0; i < count; ++i)
+        list.append(i);
+
+    const long  target = count - count / 4;     // three quarters of the way along
+    double      base_find = 0.0;
+    double      base_reduce = 0.0;
+
+    std::cout << "\nList of " << count << " nodes\n";
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        // Eight segments per thread lets a thread that finishes early take
+        // over work that would otherwise be left to a slower one.
+        auto then = clock_type::now();
+        ListSegments<SingleLinkedList<long>>    segments(list, threads * 8);
+        double build = elapsed_ms(then);
+
+        then = clock_type::now();
+        auto *found = segments.find_if([target](long value) { return value == target; }, threads);
+        double find = elapsed_ms(then);
+
+        then = clock_type::now();
+        auto add = [](long long a, long long b) { return a + b; };
+        long long sum = segments.reduce(0LL, add, add, threads);
+        double reduce = elapsed_ms(then);
+
+        then = clock_type::now();
+        std::atomic<long> evens{0};
+        segments.for_each([&evens](long value) { if (value % 2 == 0) ++evens; }, threads);
+        double for_each = elapsed_ms(then);
+
+        if (threads == 1)
+        {
+            base_find = find;
+            base_reduce = reduce;
+        }
+
+        if (found == nullptr || found->data() != target
+            || sum != static_cast<long long>(count) * (count - 1) / 2
+            || evens != (count + 1) / 2)
+            std::cout << "  Incorrect result with " << threads << " threads!\n";
+
+        std::cout << "  " << threads << " threads: table " << build
+                  << " ms, find_if " << find << " ms (x" << base_find / find
+                  << "), reduce " << reduce << " ms (x" << base_reduce / reduce
+                  << "), for_each " << for_each << " ms\n";
+    }
+}
+
+void demonstrate_segments()
+{
+    DoubleLinkedList<int>   list;
+
+    for (int i = 1; i <= 10; ++i)
+        list.append(i);
+
+    ListSegments<DoubleLinkedList<int>> segments(list, 3);
+
+    std::cout << "A list of 10 nodes in " << segments.size() << " segments:";
+    for (size_t i = 0; i < segments.size(); ++i)
+        std::cout << ' ' << segments.length(i) << " from " << segments.start(i)->data() << ';';
+
+    // The partial results are combined in list order, so an operation that
+    // is associative but not commutative gives the sequential result.
+    auto concatenate = [](long long a, long long b)
+    {
+        long long scale = 10;
+
+        while (scale <= b)
+            scale *= 10;
+        return a * scale + b;
+    };
+    long long digits = segments.reduce(0LL, concatenate, concatenate, 3);
+    std::cout << "\nConcatenating the digits gives " << digits << '\n';
+
+    // Folding a node into a partial result can differ from joining two
+    // partial results: squares are summed into each segment's result, but
+    // the segments' results are simply added.
+    auto add = [](long long a, long long b) { return a + b; };
+    long long squares = segments.reduce(0LL, [](long long a, int b) { return a + b * b; }, add, 3);
+    long long evens = segments.reduce(0LL, [](long long a, int b) { return a + (b % 2 == 0); }, add, 3);
+    std::cout << "The sum of the squares is " << squares << " and " << evens
+              << " of the numbers are even\n";
+    if (digits != 12345678910LL || squares != 385 || evens != 5)
+        std::cout << "  Incorrect result!\n";
+}
+
+} // end of anonymous namespace
+
+// Usage: parallel_list_sample_cpp [largest list size [most threads]]
+// The default is lists of up to 10,000,000 nodes and up to 32 threads.
+// A list of 100,000,000 nodes needs about 3 GB of memory.
+int main(int argc, char *argv[])
+{
+    long        max_count = argc > 1 ? std::atol(argv[1]) : 10000000;
+    unsigned    max_threads = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 32;
+
+    demonstrate_segments();
+
+    std::cout << "\nThis machine reports " << std::thread::hardware_concurrency()
+              << " hardware threads\n";
+    for (long count = 1000000; count <= max_count; count *= 10)
+        benchmark(count, max_threads);
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "../SingleLinkedList.h"
+#include "../DoubleLinkedList.h"
+
+namespace {
+
+constexpr size_t    element_count = 2000000;
+constexpr int       repetitions = 5;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// A block of cache-line-sized slots that are handed out in a random order,
+// so that consecutive nodes of a list are scattered through memory.
+class ShuffledSlots
+{
+public:
+    explicit ShuffledSlots(size_t count)
+      : _lines(count),
+        _order(count)
+    {
+        std::iota(_order.begin(), _order.end(), size_t{0});
+        std::shuffle(_order.begin(), _order.end(), std::mt19937_64{2019});
+    }
+
+    void *take()
+    {
+        return &_lines[_order[_next++ % _order.size()]];
+    }
+
+private:
+    struct alignas(64) line
+    {
+        unsigned char   bytes[64];
+    };
+
+    std::vector<line>   _lines;
+    std::vector<size_t> _order;
+    size_t              _next{0};
+};
+
+// An allocator drawing single nodes from a ShuffledSlots block. Slots are
+// not reused, so deallocation does nothing.
+template<typename T>
+class ShuffledAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ShuffledAllocator(ShuffledSlots &slots) noexcept
+      : _slots{&slots}
+    {
+    }
+
+    template<typename U>
+    ShuffledAllocator(const ShuffledAllocator<U> &other) noexcept
+      : _slots{other.slots()}
+    {
+    }
+
+    T *allocate(size_t count)
+    {
+        static_assert(sizeof(T) <= 64 && alignof(T) <= 64, "Nodes must fit in a slot");
+        if (count != 1)
+            throw std::bad_alloc();
+        return static_cast<T *>(_slots->take());
+    }
+
+    void deallocate(T *, size_t) noexcept
+    {
+    }
+
+    ShuffledSlots *slots() const noexcept
+    {
+        return _slots;
+    }
+
+private:
+    ShuffledSlots  *_slots;
+};
+
+template<typename T, typename U>
+bool operator==(const ShuffledAllocator<T> &lhs, const ShuffledAllocator<U> &rhs) noexcept
+{
+    return lhs.slots() == rhs.slots();
+}
+
+template<typename T, typename U>
+bool operator!=(const ShuffledAllocator<T> &lhs, const ShuffledAllocator<U> &rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template<typename List>
+void fill(List &list)
+{
+    for (size_t i = 0; i < element_count; ++i)
+        list.append(static_cast<long>(i));
+}
+
+template<typename List>
+void benchmark(const char *name)
+{
+    ShuffledSlots   slots(element_count * 2);
+    List            list{ShuffledAllocator<long>(slots)};
+    int             found = 0;
+
+    fill(list);
+
+    std::cout << '\n' << name << '\n';
+
+    // Searching for a value that is not present visits every node.
+    auto then = clock_type::now();
+    for (int r = 0; r < repetitions; ++r)
+        found += list.find(-1) != nullptr;
+    std::cout << "  find:                      " << elapsed_ms(then) << " ms\n";
+
+    then = clock_type::now();
+    for (int r = 0; r < repetitions; ++r)
+        found += list.find(-1, prefetch_traversal) != nullptr;
+    std::cout << "  find with prefetching:     " << elapsed_ms(then) << " ms\n";
+
+    // The allocator does not free memory, so erasing measures the traversal.
+    then = clock_type::now();
+    list.erase();
+    std::cout << "  erase:                     " << elapsed_ms(then) << " ms\n";
+
+    fill(list);
+    then = clock_type::now();
+    list.erase(prefetch_traversal);
+    std::cout << "  erase with prefetching:    " << elapsed_ms(then) << " ms\n";
+
+    if (found)
+        std::cout << "  Found a value that is not in the list!\n";
+}
+
+} // end of anonymous namespace
+
+int main()
+{
+    std::cout << "Lists of " << element_count << " nodes scattered randomly in memory, "
+              << repetitions << " full searches each\n";
+
+    benchmark<SingleLinkedList<long, ShuffledAllocator<long>>>("SingleLinkedList");
+    benchmark<DoubleLinkedList<long, ShuffledAllocator<long>>>("DoubleLinkedList");
+}
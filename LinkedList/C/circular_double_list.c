@@ -0,0 +1,284 @@
+/// \file   circular_double_list.c
+/// \brief  Implementation of a circular doubly-linked list with a sentinel
+///         node in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <stdint.h>
+#include <stdlib.h> // for malloc/free
+
+#include "circular_double_list.h"
+
+// Counters for the cdll_* functions, updated only when DS_ENABLE_STATS is
+// defined.
+static list_stats cdll_stats;
+
+/// \brief  Initializes an empty circular doubly-linked list.
+/// \param list A pointer to the list to be initialized.
+/// \remark The list's sentinel is linked to itself. A list must not be
+///         copied once initialized, since its nodes point at its sentinel.
+void cdll_init(circular_double_list *list)
+{
+    list->sentinel.data = 0;
+    list->sentinel.next = list->sentinel.prev = &list->sentinel;
+    list->count = 0;
+}
+
+/// \brief  Create a new node populated with the specified data.
+/// \param data The data to be carried by the new node.
+/// \return A pointer to a new cdll_node structure, or NULL if no memory
+///         could be allocated.
+///
+/// The node is created on the heap with malloc, and is not yet part of a
+/// list.
+cdll_node *cdll_create_node(int data)
+{
+    cdll_node *node = (cdll_node *)malloc(sizeof(cdll_node));
+
+    if (node != NULL)
+    {
+        node->prev = node->next = NULL;
+        node->data = data;
+        DS_LIST_STATS(list_stats_record_allocation(&cdll_stats, sizeof(cdll_node));)
+    }
+
+    return node;
+}
+
+/// \brief  Returns the head node of a list.
+/// \param list A pointer to the list.
+/// \return A pointer to the head node, or the sentinel if the list is empty.
+cdll_node *cdll_head(circular_double_list *list)
+{
+    return list->sentinel.next;
+}
+
+/// \brief  Returns the tail node of a list.
+/// \param list A pointer to the list.
+/// \return A pointer to the tail node, or the sentinel if the list is empty.
+cdll_node *cdll_tail(circular_double_list *list)
+{
+    return list->sentinel.prev;
+}
+
+/// \brief  Returns the sentinel of a list, at which a traversal ends.
+/// \param list A pointer to the list.
+/// \return A pointer to the sentinel node.
+cdll_node *cdll_end(circular_double_list *list)
+{
+    return &list->sentinel;
+}
+
+/// \brief  Returns the number of nodes in a list.
+/// \param list A pointer to the list.
+/// \return The number of nodes in the list.
+size_t cdll_size(const circular_double_list *list)
+{
+    return list->count;
+}
+
+/// \brief  Search a list for a node that contains the specified data.
+/// \param list         A pointer to the list.
+/// \param data         The data to find.
+/// \param direction    The direction to search, from the head forward or
+///                     from the tail backward.
+/// \return On success returns a pointer to the first node containing the
+///         desired data. On failure returns NULL.
+/// \remark The data is first stored in the sentinel, so the search always
+///         finds it and the loop needs no test for the end of the list.
+cdll_node *cdll_find_data(circular_double_list *list, int data, cdll_direction direction)
+{
+    cdll_node *current;
+    DS_LIST_STATS(uint64_t probes = 1;)
+
+    list->sentinel.data = data;
+
+    if (direction == CDLL_BACKWARD)
+    {
+        current = list->sentinel.prev;
+        while (current->data != data)
+        {
+            DS_LIST_STATS(++probes;)
+            current = current->prev;
+        }
+    }
+    else
+    {
+        current = list->sentinel.next;
+        while (current->data != data)
+        {
+            DS_LIST_STATS(++probes;)
+            current = current->next;
+        }
+    }
+
+    // Reaching the sentinel means the data is not in the list.
+    if (current == &list->sentinel)
+    {
+        DS_LIST_STATS(list_stats_record_find(&cdll_stats, probes - 1);)
+        return NULL;
+    }
+
+    DS_LIST_STATS(list_stats_record_find(&cdll_stats, probes);)
+    return current;
+}
+
+/// \brief  Appends a node to the end of a list.
+/// \param list A pointer to the list.
+/// \param node The node to be appended.
+/// \return A pointer to the appended node.
+cdll_node *cdll_append_node(circular_double_list *list, cdll_node *node)
+{
+    return cdll_insert_node_before(list, &list->sentinel, node);
+}
+
+/// \brief  Creates a new node with the specified data and appends it to the
+///         end of a list.
+/// \param list A pointer to the list.
+/// \param data The data to be stored in the new node.
+/// \return A pointer to the new node, or NULL if no memory could be allocated.
+cdll_node *cdll_append_data(circular_double_list *list, int data)
+{
+    cdll_node *node = cdll_create_node(data);
+
+    return node == NULL ? NULL : cdll_append_node(list, node);
+}
+
+/// \brief  Inserts a node at the beginning of a list.
+/// \param list A pointer to the list.
+/// \param node The node to be prepended.
+/// \return A pointer to the prepended node.
+cdll_node *cdll_prepend_node(circular_double_list *list, cdll_node *node)
+{
+    return cdll_insert_node_after(list, &list->sentinel, node);
+}
+
+/// \brief  Creates a new node with the specified data and inserts it at the
+///         beginning of a list.
+/// \param list A pointer to the list.
+/// \param data The data to be stored in the new node.
+/// \return A pointer to the new node, or NULL if no memory could be allocated.
+cdll_node *cdll_prepend_data(circular_double_list *list, int data)
+{
+    cdll_node *node = cdll_create_node(data);
+
+    return node == NULL ? NULL : cdll_prepend_node(list, node);
+}
+
+/// \brief  Inserts a node into a list, following a specified node.
+/// \param list     A pointer to the list.
+/// \param after    A pointer to the node after which the new node is to be
+///                 inserted, or the sentinel to insert at the head.
+/// \param node     A pointer to the node to be inserted.
+/// \return A pointer to the inserted node.
+cdll_node *cdll_insert_node_after(circular_double_list *list, cdll_node *after, cdll_node *node)
+{
+    node->prev = after;
+    node->next = after->next;
+    after->next->prev = node;
+    after->next = node;
+    ++list->count;
+
+    return node;
+}
+
+/// \brief  Creates a new node with the specified data and inserts it into a
+///         list, following a specified node.
+/// \param list     A pointer to the list.
+/// \param after    A pointer to the node after which the new node is to be
+///                 inserted, or the sentinel to insert at the head.
+/// \param data     The data to be stored in the new node.
+/// \return A pointer to the new node, or NULL if no memory could be allocated.
+cdll_node *cdll_insert_data_after(circular_double_list *list, cdll_node *after, int data)
+{
+    cdll_node *node = cdll_create_node(data);
+
+    return node == NULL ? NULL : cdll_insert_node_after(list, after, node);
+}
+
+/// \brief  Inserts a node into a list, before a specified node.
+/// \param list     A pointer to the list.
+/// \param before   A pointer to the node before which the new node is to be
+///                 inserted, or the sentinel to insert at the tail.
+/// \param node     A pointer to the node to be inserted.
+/// \return A pointer to the inserted node.
+cdll_node *cdll_insert_node_before(circular_double_list *list, cdll_node *before, cdll_node *node)
+{
+    return cdll_insert_node_after(list, before->prev, node);
+}
+
+/// \brief  Creates a new node with the specified data and inserts it into a
+///         list, before a specified node.
+/// \param list     A pointer to the list.
+/// \param before   A pointer to the node before which the new node is to be
+///                 inserted, or the sentinel to insert at the tail.
+/// \param data     The data to be stored in the new node.
+/// \return A pointer to the new node, or NULL if no memory could be allocated.
+cdll_node *cdll_insert_data_before(circular_double_list *list, cdll_node *before, int data)
+{
+    cdll_node *node = cdll_create_node(data);
+
+    return node == NULL ? NULL : cdll_insert_node_before(list, before, node);
+}
+
+/// \brief  Removes a node from a list.
+/// \param list A pointer to the list.
+/// \param node The node to be removed. It must not be the sentinel.
+/// \return A pointer to the node that followed the removed node, which is
+///         the sentinel if the tail was removed.
+/// \remark Memory allocated to the removed node is not freed.
+cdll_node *cdll_remove_node(circular_double_list *list, cdll_node *node)
+{
+    cdll_node *next = node->next;
+
+    node->prev->next = next;
+    next->prev = node->prev;
+    node->prev = node->next = NULL;
+    --list->count;
+
+    return next;
+}
+
+/// \brief  Erases an entire list, freeing each of its nodes.
+/// \param list A pointer to the list, which is left empty.
+void cdll_erase(circular_double_list *list)
+{
+    cdll_node *current = list->sentinel.next;
+
+    while (current != &list->sentinel)
+    {
+        cdll_node *next = current->next;
+
+        free(current);
+        DS_LIST_STATS(list_stats_record_free(&cdll_stats);)
+        current = next;
+    }
+
+    cdll_init(list);
+}
+
+/// \brief  Retrieves the counters describing the activity of the cdll_*
+///         functions.
+/// \param stats    A pointer to the structure that receives the counters.
+/// \remark The counters are updated only when the library is built with
+///         DS_ENABLE_STATS defined; otherwise they are all zero.
+/// \remark Nodes removed with cdll_remove_node are freed by the caller, so
+///         they continue to be counted as live.
+void cdll_get_stats(list_stats *stats)
+{
+    *stats = cdll_stats;
+}
+
+/// \brief  Resets the counters describing the activity of the cdll_*
+///         functions to zero.
+/// \remark The number of live nodes is preserved so that it remains correct
+///         for nodes allocated before the reset.
+void cdll_reset_stats(void)
+{
+    uint64_t live_nodes = cdll_stats.live_nodes;
+    list_stats empty = {0};
+
+    cdll_stats = empty;
+    cdll_stats.live_nodes = live_nodes;
+    cdll_stats.peak_live_nodes = live_nodes;
+}
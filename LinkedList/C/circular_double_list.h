@@ -0,0 +1,60 @@
+/// \file   circular_double_list.h
+/// \brief  Structure definitions and function declarations for a circular
+///         doubly-linked list with a sentinel node in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_CIRCULAR_DOUBLE_LIST_H
+#define INC_CIRCULAR_DOUBLE_LIST_H
+
+#include <stddef.h>
+
+#include "list_stats.h"
+
+/// \brief  The circular doubly-linked list node structure.
+typedef struct _cdll_node
+{
+    int data;                   ///< The data stored in the linked list.
+    struct _cdll_node *next;    ///< Pointer to the next node in the list.
+    struct _cdll_node *prev;    ///< Pointer to the previous node in the list.
+} cdll_node;
+
+/// \brief  A circular doubly-linked list.
+///
+/// The sentinel node follows the tail and precedes the head, so every node
+/// in the list has a neighbour on each side and an empty list is a
+/// sentinel linked to itself. Inserting and removing a node are then the
+/// same few pointer assignments wherever the node is. A traversal ends when
+/// it returns to the sentinel, given by cdll_end.
+typedef struct circular_double_list
+{
+    cdll_node sentinel;     ///< Follows the tail and precedes the head.
+    size_t count;           ///< Number of nodes in the list.
+} circular_double_list;
+
+typedef enum {
+    CDLL_FORWARD,
+    CDLL_BACKWARD
+} cdll_direction;
+
+void cdll_init(circular_double_list *list);
+cdll_node *cdll_create_node(int data);
+cdll_node *cdll_head(circular_double_list *list);
+cdll_node *cdll_tail(circular_double_list *list);
+cdll_node *cdll_end(circular_double_list *list);
+size_t cdll_size(const circular_double_list *list);
+cdll_node *cdll_find_data(circular_double_list *list, int data, cdll_direction direction);
+cdll_node *cdll_append_node(circular_double_list *list, cdll_node *node);
+cdll_node *cdll_append_data(circular_double_list *list, int data);
+cdll_node *cdll_prepend_node(circular_double_list *list, cdll_node *node);
+cdll_node *cdll_prepend_data(circular_double_list *list, int data);
+cdll_node *cdll_insert_node_after(circular_double_list *list, cdll_node *after, cdll_node *node);
+cdll_node *cdll_insert_data_after(circular_double_list *list, cdll_node *after, int data);
+cdll_node *cdll_insert_node_before(circular_double_list *list, cdll_node *before, cdll_node *node);
+cdll_node *cdll_insert_data_before(circular_double_list *list, cdll_node *before, int data);
+cdll_node *cdll_remove_node(circular_double_list *list, cdll_node *node);
+void cdll_erase(circular_double_list *list);
+void cdll_get_stats(list_stats *stats);
+void cdll_reset_stats(void);
+
+#endif  // INC_CIRCULAR_DOUBLE_LIST_H
@@ -3,9 +3,21 @@
 /// \author Jeffrey K. Bienstadt
 /// \copyright  Copyright (c) 2019--2023 Jeffrey K. Bienstadt
 
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h> // for malloc/free
 
 #include "double_linked_list.h"
+#include "list_prefetch.h"
+
+// Counters for the dll_* functions, updated only when DS_ENABLE_STATS is
+// defined.
+static list_stats dll_stats;
+
+// Number of data items copied through the buffer used by dll_serialize and
+// dll_deserialize.
+#define DLL_STREAM_CHUNK   1024
 
 /// \brief  Create a new doubly-linked list node populated with the specified data.
 /// \param data The data to be carried by the new node.
@@ -25,11 +37,39 @@ dll_node *dll_create_node(int data)
     {
         node->prev = node->next = NULL;
         node->data = data;
+        node->hits = 0;
+        DS_LIST_STATS(list_stats_record_allocation(&dll_stats, sizeof(dll_node));)
     }
 
     return node;
 }
 
+/// \brief  Creates a new doubly-linked list node populated with the specified data,
+///         obtaining its memory from a caller-supplied allocator.
+/// \param allocate A function that allocates the node's memory.
+/// \param context  The opaque pointer passed to \p allocate, such as an arena.
+/// \param data     The data to be carried by the new node.
+/// \return A pointer to a new dll_node structure, or NULL if the allocator could not
+///         obtain memory.
+///
+/// The allocator is expected to reclaim its nodes all at once. With an
+/// arena, for example, passing arena_allocate and the arena, a list is torn
+/// down by resetting or deleting the arena, whatever the length of the
+/// list, and then setting the list's head pointer to NULL. Such nodes must
+/// not be passed to dll_erase, or freed after dll_remove_node.
+dll_node *dll_create_node_from(list_allocate_fn allocate, void *context, int data)
+{
+    dll_node *node = (dll_node *)allocate(context, sizeof(dll_node));
+
+    if (node != NULL)
+    {
+        node->prev = node->next = NULL;
+        node->data = data;
+        node->hits = 0;
+    }
+
+    return node;
+}
 /// \brief  Search a linked list for a node that contains the specified data.
 /// \param start        A pointer to the node of the linked list to begin the search.
 /// \param data         The data to find.
@@ -38,6 +78,8 @@ dll_node *dll_create_node(int data)
 ///         desired data. On failure returns NULL.
 dll_node *dll_find_data(dll_node *start, int data, dll_direction direction)
 {
+    DS_LIST_STATS(uint64_t probes = 0;)
+
     if (start == NULL)
         return NULL;
 
@@ -46,8 +88,9 @@ dll_node *dll_find_data(dll_node *start, int data, dll_direction direction)
         case DLL_FORWARD:
             while (start != NULL)
             {
+                DS_LIST_STATS(++probes;)
                 if (start->data == data)
-                    return start;
+                    break;
                 start = start->next;
             }
             break;
@@ -55,17 +98,119 @@ dll_node *dll_find_data(dll_node *start, int data, dll_direction direction)
         case DLL_BACKWARD:
             while (start != NULL)
             {
+                DS_LIST_STATS(++probes;)
                 if (start->data == data)
-                    return start;
+                    break;
                 start = start->prev;
             }
             break;
 
+        default:
+            start = NULL;
+            break;
+    }
+
+    DS_LIST_STATS(list_stats_record_find(&dll_stats, probes);)
+    return start;
+}
+
+/// \brief  Search a linked list for a node that contains the specified data,
+///         prefetching nodes ahead of the one being examined.
+/// \param start        A pointer to the node of the linked list to begin the search.
+/// \param data         The data to find.
+/// \param direction    The direction to search, forward or backward.
+/// \return On success returns a pointer to the first node containing the
+///         desired data. On failure returns NULL.
+/// \remark While a node is examined, the node two places ahead in the
+///         direction of the search is prefetched.
+dll_node *dll_find_data_prefetch(dll_node *start, int data, dll_direction direction)
+{
+    DS_LIST_STATS(uint64_t probes = 0;)
+
+    if (start == NULL || (direction != DLL_FORWARD && direction != DLL_BACKWARD))
+        return NULL;
+
+    DS_PREFETCH(direction == DLL_FORWARD ? start->next : start->prev);
+
+    while (start != NULL)
+    {
+        dll_node *next = direction == DLL_FORWARD ? start->next : start->prev;
+
+        if (next != NULL)
+            DS_PREFETCH(direction == DLL_FORWARD ? next->next : next->prev);
+
+        DS_LIST_STATS(++probes;)
+        if (start->data == data)
+            break;
+        start = next;
+    }
+
+    DS_LIST_STATS(list_stats_record_find(&dll_stats, probes);)
+    return start;
+}
+
+/// \brief  Searches a linked list for a node that contains the specified
+///         data, and rearranges the list so that frequently sought data
+///         moves towards the head.
+/// \param head     A pointer to pointer to the head node of the linked list.
+/// \param data     The data to find.
+/// \param policy   How the list is rearranged when the data is found.
+/// \return On success returns a pointer to the first node containing the
+///         desired data. On failure returns NULL, and the list is unchanged.
+/// \remark The \p head parameter is a pointer to pointer. This is because the
+///         node found may become the new head of the list.
+/// \remark LIST_FREQUENCY_COUNT keeps the nodes in decreasing order of the
+///         counts in their \c hits members, which it alone updates; the
+///         other policies and the other functions leave the counts alone.
+dll_node *dll_find_data_organize(dll_node **head, int data, list_organize policy)
+{
+    dll_node *current = dll_find_data(*head, data, DLL_FORWARD);
+    dll_node *target = NULL;
+
+    if (current == NULL)
+        return NULL;
+
+    // Decide which node the node found is to be moved in front of.
+    switch (policy)
+    {
+        case LIST_MOVE_TO_FRONT:
+            target = *head;
+            break;
+
+        case LIST_TRANSPOSE:
+            target = current->prev;
+            break;
+
+        case LIST_FREQUENCY_COUNT:
+            if (current->hits != UINT_MAX)
+                ++current->hits;
+
+            // Walk back over the nodes with lower counts.
+            target = current;
+            while (target->prev != NULL && target->prev->hits < current->hits)
+                target = target->prev;
+            break;
+
         default:
             break;
     }
 
-    return NULL;
+    if (target != NULL && target != current)
+    {
+        dll_remove_node(head, current);
+        if (target == *head)
+        {
+            dll_insert_node_before(head, current);
+        }
+        else
+        {
+            dll_node *before = target;
+
+            dll_insert_node_before(&before, current);
+        }
+    }
+
+    return current;
 }
 
 /// \brief  Traverse the linked list until the head node (the first node in
@@ -147,6 +292,8 @@ dll_node *dll_insert_node_after(dll_node *after, dll_node *node)
 {
     node->next = after->next;
     node->prev = after;
+    if (after->next != NULL)
+        after->next->prev = node;
     after->next = node;
 
     return node;
@@ -251,7 +398,8 @@ void dll_remove_node(dll_node **head, dll_node *node)
     if (node == *head)
     {
         *head = (*head)->next;
-        (*head)->prev = NULL;
+        if (*head != NULL)
+            (*head)->prev = NULL;
         node->next = NULL;
     }
     else
@@ -260,7 +408,8 @@ void dll_remove_node(dll_node **head, dll_node *node)
 
         // Unlink the node from the linked list
         previous->next = node->next;
-        node->next->prev = previous;
+        if (node->next != NULL)
+            node->next->prev = previous;
         node->prev = node->next = NULL;
     }
 }
@@ -283,8 +432,169 @@ void dll_erase(dll_node **head)
         dll_node *next = current->next;
 
         free(current);
+        DS_LIST_STATS(list_stats_record_free(&dll_stats);)
+        current = next;
+    }
+
+    *head = NULL;
+}
+
+/// \brief  Erases an entire linked list, prefetching nodes ahead of the one
+///         being freed.
+/// \param head A pointer to pointer to the head node of the linked list.
+/// \remark Behaves like dll_erase, but while each node is freed the node two
+///         places ahead is prefetched.
+void dll_erase_prefetch(dll_node **head)
+{
+    dll_node *current = *head;
+
+    if (current != NULL)
+        DS_PREFETCH(current->next);
+
+    while (current != NULL)
+    {
+        dll_node *next = current->next;
+
+        if (next != NULL)
+            DS_PREFETCH(next->next);
+
+        free(current);
+        DS_LIST_STATS(list_stats_record_free(&dll_stats);)
         current = next;
     }
 
     *head = NULL;
 }
+
+/// \brief  Writes a linked list to a stream in a binary format.
+/// \param head A pointer to the head node of the linked list.
+/// \param out  The stream to which the list is written, opened in binary mode.
+/// \return Non-zero on success, zero if the list could not be written.
+/// \remark The data is written in list order, preceded by a header giving
+///         the size of each data item and the number of items, in
+///         length-prefixed chunks that are copied through a fixed-size buffer:
+///
+///             uint32  size of each data item
+///             uint64  number of items
+///             repeated until all items have been written:
+///                 uint32  number of items in this chunk
+///                 the items of the chunk
+///
+///         Integers are stored in the native byte order of the machine.
+int dll_serialize(const dll_node *head, FILE *out)
+{
+    int buffer[DLL_STREAM_CHUNK];
+    uint32_t item_size = (uint32_t)sizeof(int);
+    uint64_t count = 0;
+    const dll_node *current;
+
+    for (current = head; current != NULL; current = current->next)
+        ++count;
+
+    if (fwrite(&item_size, sizeof(item_size), 1, out) != 1
+        || fwrite(&count, sizeof(count), 1, out) != 1)
+        return 0;
+
+    current = head;
+    while (current != NULL)
+    {
+        uint32_t used = 0;
+
+        for (; used < DLL_STREAM_CHUNK && current != NULL; ++used, current = current->next)
+            buffer[used] = current->data;
+
+        if (fwrite(&used, sizeof(used), 1, out) != 1
+            || fwrite(buffer, sizeof(int), used, out) != used)
+            return 0;
+    }
+
+    return 1;
+}
+
+/// \brief  Replaces a linked list with a list read from a stream written by
+///         dll_serialize.
+/// \param head A pointer to pointer to the head node of the linked list.
+/// \param in   The stream from which the list is read, opened in binary mode.
+/// \return Non-zero on success, zero if a complete list could not be read.
+///         On failure the list holds the items read before the error.
+/// \remark The \p head parameter is a pointer to pointer. This is because the
+///         existing list is erased and a new head node is created.
+int dll_deserialize(dll_node **head, FILE *in)
+{
+    int buffer[DLL_STREAM_CHUNK];
+    uint32_t item_size;
+    uint64_t count;
+    dll_node *tail = NULL;
+
+    dll_erase(head);
+
+    if (fread(&item_size, sizeof(item_size), 1, in) != 1
+        || item_size != sizeof(int)
+        || fread(&count, sizeof(count), 1, in) != 1)
+        return 0;
+
+    while (count > 0)
+    {
+        uint32_t length;
+
+        if (fread(&length, sizeof(length), 1, in) != 1 || length == 0 || length > count)
+            return 0;
+
+        count -= length;
+
+        // The chunk may have been written with a larger buffer than ours,
+        // so it is read in pieces no larger than our buffer.
+        while (length > 0)
+        {
+            uint32_t piece = length < DLL_STREAM_CHUNK ? length : DLL_STREAM_CHUNK;
+
+            if (fread(buffer, sizeof(int), piece, in) != piece)
+                return 0;
+
+            for (uint32_t i = 0; i < piece; ++i)
+            {
+                dll_node *node = dll_create_node(buffer[i]);
+
+                if (node == NULL)
+                    return 0;
+
+                if (tail == NULL)
+                    *head = node;
+                else
+                    tail->next = node;
+                node->prev = tail;
+                tail = node;
+            }
+
+            length -= piece;
+        }
+    }
+
+    return 1;
+}
+
+/// \brief  Retrieves the counters describing the activity of the dll_*
+///         functions.
+/// \param stats    A pointer to the structure that receives the counters.
+/// \remark The counters are updated only when the library is built with
+///         DS_ENABLE_STATS defined; otherwise they are all zero.
+/// \remark Nodes removed with dll_remove_node are freed by the caller, so
+///         they continue to be counted as live.
+void dll_get_stats(list_stats *stats)
+{
+    *stats = dll_stats;
+}
+
+/// \brief  Resets the counters describing the activity of the dll_*
+///         functions to zero.
+/// \remark The number of live nodes is preserved so that it remains correct
+///         for nodes allocated before the reset.
+void dll_reset_stats(void)
+{
+    uint64_t live_nodes = dll_stats.live_nodes;
+    list_stats empty = {0};
+
+    dll_stats = empty;
+    dll_stats.live_nodes = live_nodes;
+    dll_stats.peak_live_nodes = live_nodes;
+}
@@ -6,6 +6,11 @@
 #ifndef INC_DOUBLE_LINKED_LIST_H
 #define INC_DOUBLE_LINKED_LIST_H
 
+#include <stdio.h>
+
+#include "list_allocator.h"
+#include "list_organize.h"
+#include "list_stats.h"
 
 /// \brief  The doubly-linked list node structure.
 ///
@@ -15,6 +20,7 @@
 typedef struct _dll_node
 {
     int data;               ///< The data stored in the linked list.
+    unsigned int hits;      ///< Lookups counted by LIST_FREQUENCY_COUNT searches.
     struct _dll_node *next; ///< Pointer to tne next node in the list.
     struct _dll_node *prev; ///< Pointer to tne previous node in the list.
 } dll_node;
@@ -25,7 +31,10 @@ typedef enum {
 } dll_direction;
 
 dll_node *dll_create_node(int data);
+dll_node *dll_create_node_from(list_allocate_fn allocate, void *context, int data);
 dll_node *dll_find_data(dll_node *start, int data, dll_direction direction);
+dll_node *dll_find_data_prefetch(dll_node *start, int data, dll_direction direction);
+dll_node *dll_find_data_organize(dll_node **head, int data, list_organize policy);
 dll_node *dll_find_head_node(dll_node *start);
 dll_node *dll_find_tail_node(dll_node *start);
 dll_node *dll_append_node(dll_node **head, dll_node *node);
@@ -38,5 +47,10 @@ dll_node *dll_prepend_node(dll_node **head, dll_node *node);
 dll_node *dll_prepend_data(dll_node **head, int data);
 void dll_remove_node(dll_node **head, dll_node *node);
 void dll_erase(dll_node **head);
+void dll_erase_prefetch(dll_node **head);
+int dll_serialize(const dll_node *head, FILE *out);
+int dll_deserialize(dll_node **head, FILE *in);
+void dll_get_stats(list_stats *stats);
+void dll_reset_stats(void);
 
 #endif  // INC_DOUBLE_LINKED_LIST_H
@@ -0,0 +1,25 @@
+/// \file   list_allocator.h
+/// \brief  The allocation callback through which the linked lists in C can
+///         obtain their nodes from a caller-supplied source of memory.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_ALLOCATOR_H
+#define INC_LIST_ALLOCATOR_H
+
+#include <stddef.h>
+
+/// \brief  A function that allocates memory for a list node.
+///
+/// \param context  The opaque pointer passed along with the function, such
+///                 as the allocator's own state.
+/// \param size     The number of bytes required.
+/// \return A pointer to memory suitably aligned for any basic type, or NULL
+///         if none could be obtained.
+///
+/// Nodes allocated this way are never freed by the list functions; the
+/// source of the memory is expected to reclaim them all at once, as an
+/// arena does when it is reset.
+typedef void *(*list_allocate_fn)(void *context, size_t size);
+
+#endif  // INC_LIST_ALLOCATOR_H
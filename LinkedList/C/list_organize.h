@@ -0,0 +1,18 @@
+/// \file   list_organize.h
+/// \brief  Self-organizing search policies for the linked lists in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_ORGANIZE_H
+#define INC_LIST_ORGANIZE_H
+
+/// \brief  How a self-organizing search rearranges the list after finding
+///         a node, so that frequently sought values move towards the head.
+typedef enum {
+    LIST_MOVE_TO_FRONT,     ///< Move the node found to the head of the list.
+    LIST_TRANSPOSE,         ///< Exchange the node found with the node before it.
+    LIST_FREQUENCY_COUNT    ///< Count lookups of each node, and keep the
+                            ///< nodes in decreasing order of their counts.
+} list_organize;
+
+#endif  // INC_LIST_ORGANIZE_H
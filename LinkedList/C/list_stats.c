@@ -0,0 +1,106 @@
+/// \file   list_stats.c
+/// \brief  Implementation of the instrumentation counters for the linked
+///         lists in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <inttypes.h>
+
+#include "list_stats.h"
+
+/// \brief  Record the allocation of a node.
+/// \param stats    A pointer to the counters.
+/// \param bytes    The size of the allocated node.
+void list_stats_record_allocation(list_stats *stats, size_t bytes)
+{
+    ++stats->allocations;
+    stats->bytes_allocated += bytes;
+    if (++stats->live_nodes > stats->peak_live_nodes)
+        stats->peak_live_nodes = stats->live_nodes;
+}
+
+/// \brief  Record the freeing of a node.
+/// \param stats    A pointer to the counters.
+void list_stats_record_free(list_stats *stats)
+{
+    ++stats->frees;
+    --stats->live_nodes;
+}
+
+/// \brief  Record a search that examined the given number of nodes.
+/// \param stats    A pointer to the counters.
+/// \param probes   The number of nodes examined.
+void list_stats_record_find(list_stats *stats, uint64_t probes)
+{
+    ++stats->finds;
+    stats->find_probes += probes;
+    if (probes > stats->max_find_probes)
+        stats->max_find_probes = probes;
+}
+
+/// \brief  Record a search for the predecessor of a node being removed.
+/// \param stats    A pointer to the counters.
+/// \param probes   The number of nodes examined.
+void list_stats_record_remove_scan(list_stats *stats, uint64_t probes)
+{
+    ++stats->remove_scans;
+    stats->remove_scan_probes += probes;
+    if (probes > stats->max_remove_scan)
+        stats->max_remove_scan = probes;
+}
+
+// Compute an average, avoiding division by zero.
+static double average(uint64_t total, uint64_t count)
+{
+    return count == 0 ? 0.0 : (double)total / (double)count;
+}
+
+/// \brief  Write the counters as human-readable text, one per line.
+/// \param out      The stream to which the counters are written.
+/// \param stats    A pointer to the counters.
+void list_stats_print_text(FILE *out, const list_stats *stats)
+{
+    fprintf(out,
+            "allocations:          %" PRIu64 "\n"
+            "frees:                %" PRIu64 "\n"
+            "bytes allocated:      %" PRIu64 "\n"
+            "live nodes:           %" PRIu64 "\n"
+            "peak live nodes:      %" PRIu64 "\n"
+            "finds:                %" PRIu64 "\n"
+            "average find probes:  %g\n"
+            "maximum find probes:  %" PRIu64 "\n"
+            "remove scans:         %" PRIu64 "\n"
+            "average remove scan:  %g\n"
+            "maximum remove scan:  %" PRIu64 "\n",
+            stats->allocations, stats->frees, stats->bytes_allocated,
+            stats->live_nodes, stats->peak_live_nodes, stats->finds,
+            average(stats->find_probes, stats->finds), stats->max_find_probes,
+            stats->remove_scans,
+            average(stats->remove_scan_probes, stats->remove_scans),
+            stats->max_remove_scan);
+}
+
+/// \brief  Write the counters as a JSON object.
+/// \param out      The stream to which the counters are written.
+/// \param stats    A pointer to the counters.
+void list_stats_print_json(FILE *out, const list_stats *stats)
+{
+    fprintf(out,
+            "{\"allocations\":%" PRIu64
+            ",\"frees\":%" PRIu64
+            ",\"bytes_allocated\":%" PRIu64
+            ",\"live_nodes\":%" PRIu64
+            ",\"peak_live_nodes\":%" PRIu64
+            ",\"finds\":%" PRIu64
+            ",\"average_find_probes\":%g"
+            ",\"max_find_probes\":%" PRIu64
+            ",\"remove_scans\":%" PRIu64
+            ",\"average_remove_scan\":%g"
+            ",\"max_remove_scan\":%" PRIu64 "}",
+            stats->allocations, stats->frees, stats->bytes_allocated,
+            stats->live_nodes, stats->peak_live_nodes, stats->finds,
+            average(stats->find_probes, stats->finds), stats->max_find_probes,
+            stats->remove_scans,
+            average(stats->remove_scan_probes, stats->remove_scans),
+            stats->max_remove_scan);
+}
@@ -0,0 +1,53 @@
+/// \file   list_stats.h
+/// \brief  Optional instrumentation counters for the linked lists in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_LIST_STATS_H
+#define INC_LIST_STATS_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/// \brief  Statements passed to this macro are compiled only when the
+///         instrumentation counters are enabled by defining DS_ENABLE_STATS.
+///
+/// When DS_ENABLE_STATS is not defined the counters are never updated, so
+/// the instrumentation costs nothing.
+#if defined(DS_ENABLE_STATS)
+#  define DS_LIST_STATS(...)    __VA_ARGS__
+#else
+#  define DS_LIST_STATS(...)
+#endif
+
+/// \brief  Counters describing the activity of the singly- or doubly-linked
+///         list functions.
+///
+/// The C lists have no list object, so the counters cover every list
+/// manipulated through one family of functions (sll_* or dll_*). Only the
+/// memory allocated and freed by those functions is counted; a node that is
+/// removed from a list and then freed by the caller remains counted as live.
+/// The counters are not synchronized between threads.
+typedef struct list_stats
+{
+    uint64_t allocations;           ///< Number of nodes allocated
+    uint64_t frees;                 ///< Number of nodes freed
+    uint64_t bytes_allocated;       ///< Total bytes allocated for nodes
+    uint64_t live_nodes;            ///< Nodes allocated but not yet freed
+    uint64_t peak_live_nodes;       ///< Largest value of live_nodes
+    uint64_t finds;                 ///< Number of searches for data
+    uint64_t find_probes;           ///< Nodes examined by all searches
+    uint64_t max_find_probes;       ///< Most nodes examined by one search
+    uint64_t remove_scans;          ///< Removals that searched for a predecessor
+    uint64_t remove_scan_probes;    ///< Nodes examined by all those searches
+    uint64_t max_remove_scan;       ///< Most nodes examined by one search
+} list_stats;
+
+void list_stats_record_allocation(list_stats *stats, size_t bytes);
+void list_stats_record_free(list_stats *stats);
+void list_stats_record_find(list_stats *stats, uint64_t probes);
+void list_stats_record_remove_scan(list_stats *stats, uint64_t probes);
+void list_stats_print_text(FILE *out, const list_stats *stats);
+void list_stats_print_json(FILE *out, const list_stats *stats);
+
+#endif  // INC_LIST_STATS_H
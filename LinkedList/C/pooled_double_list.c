@@ -0,0 +1,507 @@
+/// \file   pooled_double_list.c
+/// \brief  Implementation of a pooled, index-linked doubly-linked list in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <stdlib.h> // for malloc/realloc/free
+#include <string.h> // for memcpy
+
+#include "list_prefetch.h"
+#include "pooled_double_list.h"
+
+// Number of data elements compared together by pdl_find_data_unordered.
+// The comparisons within a block are independent of each other, which
+// allows the compiler to evaluate a block with vector instructions.
+#define PDL_SCAN_BLOCK  16
+
+// Number of nodes whose data is prefetched together by
+// pdl_find_data_prefetch.
+#define PDL_PREFETCH_BATCH  16
+
+/// \brief  Grow the arrays of a pooled list so that at least one more slot
+///         is available.
+/// \param list A pointer to the pooled list.
+/// \return Non-zero on success, zero if memory could not be allocated.
+static int pdl_grow(pooled_double_list *list)
+{
+    pdl_index new_capacity;
+    int *data;
+    pdl_index *next;
+    pdl_index *prev;
+
+    if (list->capacity >= PDL_UNLINKED)
+        return 0;
+
+    if (list->capacity == 0)
+        new_capacity = 16;
+    else if (list->capacity > PDL_UNLINKED / 2)
+        new_capacity = PDL_UNLINKED;
+    else
+        new_capacity = list->capacity * 2;
+
+    // Each array is replaced as soon as it is successfully reallocated, so
+    // a failure part way through leaves the list consistent at its old
+    // capacity.
+    data = (int *)realloc(list->data, new_capacity * sizeof(int));
+    if (data == NULL)
+        return 0;
+    list->data = data;
+
+    next = (pdl_index *)realloc(list->next, new_capacity * sizeof(pdl_index));
+    if (next == NULL)
+        return 0;
+    list->next = next;
+
+    prev = (pdl_index *)realloc(list->prev, new_capacity * sizeof(pdl_index));
+    if (prev == NULL)
+        return 0;
+    list->prev = prev;
+
+    list->capacity = new_capacity;
+
+    return 1;
+}
+
+/// \brief  Create a new, empty pooled list.
+/// \param capacity The number of nodes for which to reserve space. The list
+///                 grows as necessary beyond this capacity.
+/// \return A pointer to a new pooled list, or NULL if memory could not be
+///         allocated.
+pooled_double_list *pdl_create(pdl_index capacity)
+{
+    pooled_double_list *list = (pooled_double_list *)malloc(sizeof(pooled_double_list));
+
+    if (list == NULL)
+        return NULL;
+
+    if (capacity > PDL_UNLINKED)
+        capacity = PDL_UNLINKED;
+
+    list->data = NULL;
+    list->next = list->prev = NULL;
+    list->capacity = list->used = list->count = 0;
+    list->head = list->tail = list->free_head = PDL_NIL;
+
+    if (capacity > 0)
+    {
+        list->data = (int *)malloc(capacity * sizeof(int));
+        list->next = (pdl_index *)malloc(capacity * sizeof(pdl_index));
+        list->prev = (pdl_index *)malloc(capacity * sizeof(pdl_index));
+        if (list->data == NULL || list->next == NULL || list->prev == NULL)
+        {
+            pdl_delete(list);
+            return NULL;
+        }
+        list->capacity = capacity;
+    }
+
+    return list;
+}
+
+/// \brief  Delete a pooled list, freeing all of its memory.
+/// \param list A pointer to the pooled list to be deleted.
+void pdl_delete(pooled_double_list *list)
+{
+    free(list->data);
+    free(list->next);
+    free(list->prev);
+    free(list);
+}
+
+/// \brief  Create an exact copy of a pooled list.
+/// \param list A pointer to the pooled list to be copied.
+/// \return A pointer to the new copy, or NULL if memory could not be allocated.
+/// \remark Because the links are indices, the copy is made with three
+///         \c memcpy calls and every node keeps its index in the copy.
+pooled_double_list *pdl_clone(const pooled_double_list *list)
+{
+    pooled_double_list *copy = pdl_create(list->used);
+
+    if (copy == NULL)
+        return NULL;
+
+    if (list->used > 0)
+    {
+        memcpy(copy->data, list->data, list->used * sizeof(int));
+        memcpy(copy->next, list->next, list->used * sizeof(pdl_index));
+        memcpy(copy->prev, list->prev, list->used * sizeof(pdl_index));
+    }
+    copy->used = list->used;
+    copy->count = list->count;
+    copy->head = list->head;
+    copy->tail = list->tail;
+    copy->free_head = list->free_head;
+
+    return copy;
+}
+
+/// \brief  Return the number of nodes linked into a pooled list.
+/// \param list A pointer to the pooled list.
+/// \return The number of nodes in the list.
+size_t pdl_size(const pooled_double_list *list)
+{
+    return list->count;
+}
+
+/// \brief  Create a new node populated with the specified data.
+/// \param list A pointer to the pooled list in which to create the node.
+/// \param data The data to be carried by the new node.
+/// \return The index of the new node, or PDL_NIL if memory could not be
+///         allocated.
+///
+/// The node is taken from the list's free slots if any are available,
+/// otherwise the pool is grown.
+///
+/// The new node is not yet part of the linked list. The node will have to be
+/// added to the list via one of the other functions.
+pdl_index pdl_create_node(pooled_double_list *list, int data)
+{
+    pdl_index node;
+
+    if (list->free_head != PDL_NIL)
+    {
+        node = list->free_head;
+        list->free_head = list->next[node];
+    }
+    else
+    {
+        if (list->used == list->capacity && !pdl_grow(list))
+            return PDL_NIL;
+        node = list->used++;
+    }
+
+    list->data[node] = data;
+    list->next[node] = PDL_NIL;
+    list->prev[node] = PDL_UNLINKED;
+
+    return node;
+}
+
+/// \brief  Return a node's slot to the pool's free list.
+/// \param list A pointer to the pooled list.
+/// \param node The index of a node that is not linked into the list.
+void pdl_free_node(pooled_double_list *list, pdl_index node)
+{
+    list->prev[node] = PDL_UNLINKED;
+    list->next[node] = list->free_head;
+    list->free_head = node;
+}
+
+/// \brief  Search a pooled list for a node that contains the specified data.
+/// \param list         A pointer to the pooled list.
+/// \param start        The index of the node at which to begin the search.
+/// \param data         The data to find.
+/// \param direction    The direction to search, forward or backward.
+/// \return On success returns the index of the first node containing the
+///         desired data. On failure returns PDL_NIL.
+pdl_index pdl_find_data(const pooled_double_list *list, pdl_index start, int data, pdl_direction direction)
+{
+    const pdl_index *links;
+
+    switch (direction)
+    {
+        case PDL_FORWARD:
+            links = list->next;
+            break;
+
+        case PDL_BACKWARD:
+            links = list->prev;
+            break;
+
+        default:
+            return PDL_NIL;
+    }
+
+    while (start != PDL_NIL)
+    {
+        if (list->data[start] == data)
+            return start;
+        start = links[start];
+    }
+
+    return PDL_NIL;
+}
+
+/// \brief  Search a pooled list for a node that contains the specified data,
+///         prefetching the data of several nodes at a time.
+/// \param list         A pointer to the pooled list.
+/// \param start        The index of the node at which to begin the search.
+/// \param data         The data to find.
+/// \param direction    The direction to search, forward or backward.
+/// \return On success returns the index of the first node containing the
+///         desired data. On failure returns PDL_NIL.
+/// \remark The links are followed ahead of the comparisons: the indices of
+///         a batch of nodes are gathered, with a prefetch issued for the data
+///         of each, and then the batch is compared. The loads of the data
+///         array, which is touched at scattered positions when the list has
+///         been shuffled, are thereby overlapped with one another and with
+///         the walk along the much smaller link array.
+pdl_index pdl_find_data_prefetch(const pooled_double_list *list, pdl_index start, int data, pdl_direction direction)
+{
+    const pdl_index *links;
+    pdl_index batch[PDL_PREFETCH_BATCH];
+
+    switch (direction)
+    {
+        case PDL_FORWARD:
+            links = list->next;
+            break;
+
+        case PDL_BACKWARD:
+            links = list->prev;
+            break;
+
+        default:
+            return PDL_NIL;
+    }
+
+    while (start != PDL_NIL)
+    {
+        int count = 0;
+
+        for (; count < PDL_PREFETCH_BATCH && start != PDL_NIL; ++count)
+        {
+            DS_PREFETCH(&list->data[start]);
+            batch[count] = start;
+            start = links[start];
+        }
+
+        for (int i = 0; i < count; ++i)
+            if (list->data[batch[i]] == data)
+                return batch[i];
+    }
+
+    return PDL_NIL;
+}
+
+/// \brief  Search a pooled list for any node that contains the specified data.
+/// \param list A pointer to the pooled list.
+/// \param data The data to find.
+/// \return On success returns the index of a node containing the desired
+///         data. On failure returns PDL_NIL.
+/// \remark The \c data array is scanned sequentially rather than following
+///         the links, so when several nodes hold the value the one returned
+///         is not necessarily the first in list order.
+pdl_index pdl_find_data_unordered(const pooled_double_list *list, int data)
+{
+    const int *values = list->data;
+    pdl_index i = 0;
+
+    for (; list->used - i >= PDL_SCAN_BLOCK; i += PDL_SCAN_BLOCK)
+    {
+        int hit = 0;
+
+        for (int j = 0; j < PDL_SCAN_BLOCK; ++j)
+            hit |= values[i + j] == data;
+
+        if (hit)
+            for (int j = 0; j < PDL_SCAN_BLOCK; ++j)
+                if (values[i + j] == data && list->prev[i + j] != PDL_UNLINKED)
+                    return i + j;
+    }
+
+    for (; i < list->used; ++i)
+        if (values[i] == data && list->prev[i] != PDL_UNLINKED)
+            return i;
+
+    return PDL_NIL;
+}
+
+/// \brief  Traverse the list until the head node (the first node in
+///         the list) is found.
+/// \param list     A pointer to the pooled list.
+/// \param start    The index of the node from which to begin the search.
+/// \return On success returns the index of the head node of the list.
+///         On failure returns PDL_NIL.
+pdl_index pdl_find_head_node(const pooled_double_list *list, pdl_index start)
+{
+    if (start == PDL_NIL)
+        return PDL_NIL;
+
+    while (list->prev[start] != PDL_NIL)
+        start = list->prev[start];
+
+    return start;
+}
+
+/// \brief  Traverse the list until the tail node (the last node in
+///         the list) is found.
+/// \param list     A pointer to the pooled list.
+/// \param start    The index of the node from which to begin the search.
+/// \return On success returns the index of the tail node of the list.
+///         On failure returns PDL_NIL.
+pdl_index pdl_find_tail_node(const pooled_double_list *list, pdl_index start)
+{
+    if (start == PDL_NIL)
+        return PDL_NIL;
+
+    while (list->next[start] != PDL_NIL)
+        start = list->next[start];
+
+    return start;
+}
+
+/// \brief  Appends a node to the end of the list.
+/// \param list A pointer to the pooled list.
+/// \param node The index of the node to be appended to the list.
+/// \return The index of the appended node.
+pdl_index pdl_append_node(pooled_double_list *list, pdl_index node)
+{
+    if (list->tail == PDL_NIL)
+        return pdl_prepend_node(list, node);
+
+    return pdl_insert_node_after(list, list->tail, node);
+}
+
+/// \brief  Creates a new node with the specified data and appends the node to
+///         the end of the list.
+/// \param list A pointer to the pooled list.
+/// \param data The data to be stored in the created and appended node.
+/// \return The index of the newly created and appended node, or PDL_NIL if
+///         memory could not be allocated.
+pdl_index pdl_append_data(pooled_double_list *list, int data)
+{
+    pdl_index node = pdl_create_node(list, data);
+
+    return node == PDL_NIL ? PDL_NIL : pdl_append_node(list, node);
+}
+
+/// \brief  Inserts a node into the list, following a specified node.
+/// \param list     A pointer to the pooled list.
+/// \param after    The index of the node after which the new node is to be
+///                 inserted. This parameter must not be PDL_NIL.
+/// \param node     The index of the node to be inserted.
+/// \return The index of the inserted node.
+pdl_index pdl_insert_node_after(pooled_double_list *list, pdl_index after, pdl_index node)
+{
+    pdl_index next = list->next[after];
+
+    list->next[node] = next;
+    list->prev[node] = after;
+    list->next[after] = node;
+    if (next == PDL_NIL)
+        list->tail = node;
+    else
+        list->prev[next] = node;
+
+    ++list->count;
+
+    return node;
+}
+
+/// \brief  Creates a new node with the specified data and inserts the node
+///         into the list following a specified node.
+/// \param list     A pointer to the pooled list.
+/// \param after    The index of the node after which the new node is to be
+///                 inserted. This parameter must not be PDL_NIL.
+/// \param data     The data to be stored in the created and inserted node.
+/// \return The index of the newly created and inserted node, or PDL_NIL if
+///         memory could not be allocated.
+pdl_index pdl_insert_data_after(pooled_double_list *list, pdl_index after, int data)
+{
+    pdl_index node = pdl_create_node(list, data);
+
+    return node == PDL_NIL ? PDL_NIL : pdl_insert_node_after(list, after, node);
+}
+
+/// \brief  Inserts a node into the list, before a specified node.
+/// \param list     A pointer to the pooled list.
+/// \param before   The index of the node before which the new node is to be
+///                 inserted. If PDL_NIL the node is inserted into an empty
+///                 list as its only node.
+/// \param node     The index of the node to be inserted.
+/// \return The index of the inserted node.
+pdl_index pdl_insert_node_before(pooled_double_list *list, pdl_index before, pdl_index node)
+{
+    if (before == PDL_NIL || list->prev[before] == PDL_NIL)
+        return pdl_prepend_node(list, node);
+
+    return pdl_insert_node_after(list, list->prev[before], node);
+}
+
+/// \brief  Creates a new node with the specified data and inserts the node
+///         into the list before a specified node.
+/// \param list     A pointer to the pooled list.
+/// \param before   The index of the node before which the new node is to be
+///                 inserted.
+/// \param data     The data to be stored in the created and inserted node.
+/// \return The index of the newly created and inserted node, or PDL_NIL if
+///         memory could not be allocated.
+pdl_index pdl_insert_data_before(pooled_double_list *list, pdl_index before, int data)
+{
+    pdl_index node = pdl_create_node(list, data);
+
+    return node == PDL_NIL ? PDL_NIL : pdl_insert_node_before(list, before, node);
+}
+
+/// \brief  Inserts a node at the beginning of the list. The node becomes the
+///         new head of the list.
+/// \param list A pointer to the pooled list.
+/// \param node The index of the node to be inserted.
+/// \return The index of the prepended node.
+pdl_index pdl_prepend_node(pooled_double_list *list, pdl_index node)
+{
+    list->next[node] = list->head;
+    list->prev[node] = PDL_NIL;
+    if (list->head == PDL_NIL)
+        list->tail = node;
+    else
+        list->prev[list->head] = node;
+    list->head = node;
+
+    ++list->count;
+
+    return node;
+}
+
+/// \brief  Creates a new node with the specified data and inserts the node at
+///         the beginning of the list.
+/// \param list A pointer to the pooled list.
+/// \param data The data to be stored in the created and prepended node.
+/// \return The index of the newly created and prepended node, or PDL_NIL if
+///         memory could not be allocated.
+pdl_index pdl_prepend_data(pooled_double_list *list, int data)
+{
+    pdl_index node = pdl_create_node(list, data);
+
+    return node == PDL_NIL ? PDL_NIL : pdl_prepend_node(list, node);
+}
+
+/// \brief  Removes a node from the list.
+/// \param list A pointer to the pooled list.
+/// \param node The index of the node to be removed from the list.
+/// \remark The removed node's slot is not freed; pass it to pdl_free_node
+///         when it is no longer needed, or link it into the list again.
+void pdl_remove_node(pooled_double_list *list, pdl_index node)
+{
+    pdl_index next = list->next[node];
+    pdl_index prev = list->prev[node];
+
+    if (prev == PDL_UNLINKED)
+        return; // Not in the list, do nothing
+
+    if (prev == PDL_NIL)
+        list->head = next;
+    else
+        list->next[prev] = next;
+
+    if (next == PDL_NIL)
+        list->tail = prev;
+    else
+        list->prev[next] = prev;
+
+    list->next[node] = PDL_NIL;
+    list->prev[node] = PDL_UNLINKED;
+    --list->count;
+}
+
+/// \brief  Erases an entire list.
+/// \param list A pointer to the pooled list.
+/// \remark Every slot, including those of nodes that were created but never
+///         linked into the list, becomes free. The pool's memory is retained
+///         for reuse and is freed by pdl_delete.
+void pdl_erase(pooled_double_list *list)
+{
+    list->used = list->count = 0;
+    list->head = list->tail = list->free_head = PDL_NIL;
+}
@@ -0,0 +1,72 @@
+/// \file   pooled_double_list.h
+/// \brief  Structure definition and function declarations for a pooled,
+///         index-linked doubly-linked list in C.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_POOLED_DOUBLE_LIST_H
+#define INC_POOLED_DOUBLE_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// \brief  Identifies a node in a pooled doubly-linked list.
+typedef uint32_t pdl_index;
+
+/// \brief  The index value that does not refer to any node, the pooled
+///         list's equivalent of NULL.
+#define PDL_NIL         ((pdl_index)UINT32_MAX)
+
+/// \brief  The \c prev value of a node that is not linked into the list.
+#define PDL_UNLINKED    ((pdl_index)(UINT32_MAX - 1))
+
+/// \brief  A doubly-linked list of integers stored as a structure of arrays.
+///
+/// The data, next and previous links of node \c i are \c data[i],
+/// \c next[i] and \c prev[i]. Links are 32-bit indices into these arrays
+/// rather than pointers, so the entire list can be copied with \c memcpy
+/// or written to a file as-is, and the \c data array can be scanned
+/// sequentially when the order of the elements does not matter.
+///
+/// Slots of freed nodes are kept on a free list threaded through \c next.
+typedef struct pooled_double_list
+{
+    int       *data;        ///< The data stored in each node.
+    pdl_index *next;        ///< Index of the next node in the list.
+    pdl_index *prev;        ///< Index of the previous node in the list.
+    pdl_index  capacity;    ///< Number of slots allocated in each array.
+    pdl_index  used;        ///< Number of slots ever handed out.
+    pdl_index  count;       ///< Number of nodes linked into the list.
+    pdl_index  head;        ///< Index of the head node.
+    pdl_index  tail;        ///< Index of the tail node.
+    pdl_index  free_head;   ///< Index of the first free slot.
+} pooled_double_list;
+
+typedef enum {
+    PDL_FORWARD,
+    PDL_BACKWARD
+} pdl_direction;
+
+pooled_double_list *pdl_create(pdl_index capacity);
+void pdl_delete(pooled_double_list *list);
+pooled_double_list *pdl_clone(const pooled_double_list *list);
+size_t pdl_size(const pooled_double_list *list);
+pdl_index pdl_create_node(pooled_double_list *list, int data);
+void pdl_free_node(pooled_double_list *list, pdl_index node);
+pdl_index pdl_find_data(const pooled_double_list *list, pdl_index start, int data, pdl_direction direction);
+pdl_index pdl_find_data_prefetch(const pooled_double_list *list, pdl_index start, int data, pdl_direction direction);
+pdl_index pdl_find_data_unordered(const pooled_double_list *list, int data);
+pdl_index pdl_find_head_node(const pooled_double_list *list, pdl_index start);
+pdl_index pdl_find_tail_node(const pooled_double_list *list, pdl_index start);
+pdl_index pdl_append_node(pooled_double_list *list, pdl_index node);
+pdl_index pdl_append_data(pooled_double_list *list, int data);
+pdl_index pdl_insert_node_after(pooled_double_list *list, pdl_index after, pdl_index node);
+pdl_index pdl_insert_data_after(pooled_double_list *list, pdl_index after, int data);
+pdl_index pdl_insert_node_before(pooled_double_list *list, pdl_index before, pdl_index node);
+pdl_index pdl_insert_data_before(pooled_double_list *list, pdl_index before, int data);
+pdl_index pdl_prepend_node(pooled_double_list *list, pdl_index node);
+pdl_index pdl_prepend_data(pooled_double_list *list, int data);
+void pdl_remove_node(pooled_double_list *list, pdl_index node);
+void pdl_erase(pooled_double_list *list);
+
+#endif  // INC_POOLED_DOUBLE_LIST_H
@@ -0,0 +1,211 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../double_linked_list.h"
+#include "../circular_double_list.h"
+
+#define OPERATION_COUNT 5000000
+
+// Helper function to compute the processor time used since a starting point.
+long elapsed_ms(clock_t then)
+{
+    return (long)((clock() - then) * 1000 / CLOCKS_PER_SEC);
+}
+
+// A small generator, so that every list sees the same operations.
+static unsigned long long random_state;
+
+size_t random_below(size_t limit)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return (size_t)(random_state % limit);
+}
+
+// Decide whether the next operation inserts, keeping the list near the
+// chosen length whatever the mix.
+int choose_insert(size_t count, size_t length, int insert_percent)
+{
+    return count == 0 || (count < 2 * length && (int)random_below(100) < insert_percent);
+}
+
+// Apply a random mix of insertions and removals at random positions to a
+// doubly-linked list kept at about the given length. The positions are
+// chosen from a table of the list's nodes, so no time is spent searching.
+long run_double_list(size_t length, int insert_percent)
+{
+    dll_node **nodes = (dll_node **)malloc(2 * length * sizeof(dll_node *));
+    dll_node *head = NULL;
+    size_t count = 0;
+    size_t forward = 0, backward = 0;
+    dll_node *node;
+    clock_t then;
+    int i;
+
+    random_state = 88172645463325252ULL;
+    for (count = 0; count < length; ++count)
+        nodes[count] = dll_append_data(&head, (int)count);
+
+    then = clock();
+    for (i = 0; i < OPERATION_COUNT; ++i)
+    {
+        size_t at = count == 0 ? 0 : random_below(count);
+
+        if (choose_insert(count, length, insert_percent))
+        {
+            node = dll_create_node(i);
+
+            if (count == 0)
+            {
+                dll_prepend_node(&head, node);
+            }
+            else if (i & 1)
+            {
+                dll_insert_node_after(nodes[at], node);
+            }
+            else if (nodes[at] == head)
+            {
+                dll_insert_node_before(&head, node);
+            }
+            else
+            {
+                dll_node *before = nodes[at];
+                dll_insert_node_before(&before, node);
+            }
+
+            nodes[count++] = node;
+        }
+        else
+        {
+            dll_remove_node(&head, nodes[at]);
+            free(nodes[at]);
+            nodes[at] = nodes[--count];
+        }
+    }
+    long time = elapsed_ms(then);
+
+    for (node = head; node != NULL; node = node->next)
+        ++forward;
+    for (node = dll_find_tail_node(head); node != NULL; node = node->prev)
+        ++backward;
+    if (forward != count || backward != count)
+        printf("  The doubly-linked list is damaged!\n");
+
+    dll_erase(&head);
+    free(nodes);
+    return time;
+}
+
+// The same operations on a circular doubly-linked list.
+long run_circular_list(size_t length, int insert_percent)
+{
+    cdll_node **nodes = (cdll_node **)malloc(2 * length * sizeof(cdll_node *));
+    circular_double_list list;
+    size_t count = 0;
+    size_t forward = 0, backward = 0;
+    cdll_node *node;
+    clock_t then;
+    int i;
+
+    cdll_init(&list);
+    random_state = 88172645463325252ULL;
+    for (count = 0; count < length; ++count)
+        nodes[count] = cdll_append_data(&list, (int)count);
+
+    then = clock();
+    for (i = 0; i < OPERATION_COUNT; ++i)
+    {
+        size_t at = count == 0 ? 0 : random_below(count);
+
+        if (choose_insert(count, length, insert_percent))
+        {
+            node = cdll_create_node(i);
+
+            if (count == 0)
+                cdll_prepend_node(&list, node);
+            else if (i & 1)
+                cdll_insert_node_after(&list, nodes[at], node);
+            else
+                cdll_insert_node_before(&list, nodes[at], node);
+
+            nodes[count++] = node;
+        }
+        else
+        {
+            cdll_remove_node(&list, nodes[at]);
+            free(nodes[at]);
+            nodes[at] = nodes[--count];
+        }
+    }
+    long time = elapsed_ms(then);
+
+    for (node = cdll_head(&list); node != cdll_end(&list); node = node->next)
+        ++forward;
+    for (node = cdll_tail(&list); node != cdll_end(&list); node = node->prev)
+        ++backward;
+    if (forward != count || backward != count || cdll_size(&list) != count)
+        printf("  The circular list is damaged!\n");
+
+    cdll_erase(&list);
+    free(nodes);
+    return time;
+}
+
+void demonstrate_circular_list(void)
+{
+    circular_double_list list;
+    cdll_node *node;
+    cdll_node *removed;
+
+    cdll_init(&list);
+    cdll_append_data(&list, 2);
+    cdll_prepend_data(&list, 1);
+    cdll_append_data(&list, 4);
+    cdll_insert_data_before(&list, cdll_find_data(&list, 4, CDLL_FORWARD), 3);
+    cdll_insert_data_after(&list, cdll_tail(&list), 5);
+
+    printf("Circular list of %zu nodes:", cdll_size(&list));
+    for (node = cdll_head(&list); node != cdll_end(&list); node = node->next)
+        printf(" %d", node->data);
+    printf("\nBackward:");
+    for (node = cdll_tail(&list); node != cdll_end(&list); node = node->prev)
+        printf(" %d", node->data);
+
+    removed = cdll_find_data(&list, 1, CDLL_BACKWARD);
+    node = cdll_remove_node(&list, removed);
+    free(removed);
+    printf("\nAfter removing the head, the list begins with %d\n", node->data);
+    printf("Searching for 9 %s\n", cdll_find_data(&list, 9, CDLL_FORWARD) ? "found it" : "did not find it");
+
+    cdll_erase(&list);
+}
+
+int main(void)
+{
+    static const size_t lengths[] = {4, 64, 10000};
+    static const int mixes[] = {50, 30};
+    size_t l;
+    size_t m;
+
+    demonstrate_circular_list();
+
+    printf("\n%d random insertions and removals\n", OPERATION_COUNT);
+    for (l = 0; l < sizeof(lengths) / sizeof(lengths[0]); ++l)
+    {
+        printf("\nLists of about %zu nodes\n", lengths[l]);
+        for (m = 0; m < sizeof(mixes) / sizeof(mixes[0]); ++m)
+        {
+            long double_time = run_double_list(lengths[l], mixes[m]);
+            long circular_time = run_circular_list(lengths[l], mixes[m]);
+
+            printf("  %d%% inserts: dll_* %ld ms, cdll_* %ld ms\n",
+                   mixes[m], double_time, circular_time);
+        }
+    }
+
+    return 0;
+}
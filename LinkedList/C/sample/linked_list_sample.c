@@ -105,8 +105,7 @@ void test_singly_linked_list()
 
     // We can remove a node from the list, also without copying data.
     node = sll_find_data(list_head, 42);
-    sll_remove_node(&list_head, node);
-    free(node); // We're responsible for freeing the memory for the node.
+    sll_remove_node(&list_head, node); // Memory for the node is freed.
     traverse_single_list(list_head);
 
     // We can erase the entire list
@@ -286,11 +285,65 @@ void test_doubly_linked_list()
 #endif
 }
 
+void test_serialization(void)
+{
+    sll_node *single_head = NULL;
+    dll_node *double_head = NULL;
+    FILE *file = tmpfile();
+
+    printf("Serializing a singly-linked list\n");
+
+    if (file == NULL)
+    {
+        printf("Failed to create a temporary file\n");
+        return;
+    }
+
+    for (int i = 0; i < 5; i++)
+        sll_append_data(&single_head, i * 10);
+
+    // The format is shared, so a singly-linked list can be read back as a
+    // doubly-linked list.
+    if (sll_serialize(single_head, file)
+        && fseek(file, 0, SEEK_SET) == 0
+        && dll_deserialize(&double_head, file))
+        traverse_double_list(dll_find_tail_node(double_head), DLL_BACKWARD);
+    else
+        printf("Serialization failed!\n");
+
+    fclose(file);
+    sll_erase(&single_head);
+    dll_erase(&double_head);
+}
+
+void show_stats(void)
+{
+    list_stats stats;
+
+#if !defined(DS_ENABLE_STATS)
+    printf("Instrumentation is disabled; "
+           "configure with -DENABLE_STATS=ON to collect counters.\n");
+#endif
+
+    sll_get_stats(&stats);
+    printf("\nSingly-linked list counters:\n");
+    list_stats_print_text(stdout, &stats);
+
+    dll_get_stats(&stats);
+    printf("\nDoubly-linked list counters as JSON:\n");
+    list_stats_print_json(stdout, &stats);
+    printf("\n");
+}
+
 int main(void)
 {
     test_singly_linked_list();
     printf("\n\n=================================================\n\n");
     test_doubly_linked_list();
+    printf("\n\n=================================================\n\n");
+    test_serialization();
+    printf("\n\n=================================================\n\n");
+    show_stats();
 
     return 0;
 }
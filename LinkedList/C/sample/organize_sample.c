@@ -0,0 +1,231 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../single_linked_list.h"
+#include "../double_linked_list.h"
+
+#define KEY_COUNT       1000
+#define LOOKUP_COUNT    1000000
+#define ZIPF_EXPONENT   1.0
+
+// A search with no rearrangement, for comparison with the policies.
+#define NO_POLICY       (-1)
+
+// Helper function to compute the processor time used since a starting point.
+long elapsed_ms(clock_t then)
+{
+    return (long)((clock() - then) * 1000 / CLOCKS_PER_SEC);
+}
+
+// A small generator, so that the lookups are the same on every platform.
+static unsigned long long random_state = 88172645463325252ULL;
+
+unsigned long long random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return random_state;
+}
+
+// Fill an array with a random permutation of 0 .. count-1.
+void make_permutation(int *order, int count)
+{
+    int i;
+
+    for (i = 0; i < count; ++i)
+        order[i] = i;
+    for (i = count - 1; i > 0; --i)
+    {
+        int j = (int)(random_next() % (unsigned long long)(i + 1));
+        int t = order[i];
+
+        order[i] = order[j];
+        order[j] = t;
+    }
+}
+
+// Draw keys so that the k-th most popular key is drawn in proportion to
+// 1 / k^s.
+void make_zipf_lookups(int *lookups, const int *by_popularity)
+{
+    double cumulative[KEY_COUNT];
+    double total = 0.0;
+    size_t i;
+    int k;
+
+    for (k = 0; k < KEY_COUNT; ++k)
+        cumulative[k] = total += 1.0 / pow(k + 1, ZIPF_EXPONENT);
+
+    for (i = 0; i < LOOKUP_COUNT; ++i)
+    {
+        double u = (double)(random_next() >> 11) / 9007199254740992.0 * total;
+        int low = 0;
+        int high = KEY_COUNT - 1;
+
+        // Find the first rank whose cumulative weight reaches u.
+        while (low < high)
+        {
+            int middle = (low + high) / 2;
+
+            if (cumulative[middle] < u)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        lookups[i] = by_popularity[low];
+    }
+}
+
+const char *policy_name(int policy)
+{
+    switch (policy)
+    {
+        case LIST_MOVE_TO_FRONT:    return "move to front";
+        case LIST_TRANSPOSE:        return "transpose";
+        case LIST_FREQUENCY_COUNT:  return "frequency count";
+        default:                    return "find";
+    }
+}
+
+sll_node *sll_lookup(sll_node **head, int data, int policy)
+{
+    if (policy == NO_POLICY)
+        return sll_find_data(*head, data);
+    return sll_find_data_organize(head, data, (list_organize)policy);
+}
+
+dll_node *dll_lookup(dll_node **head, int data, int policy)
+{
+    if (policy == NO_POLICY)
+        return dll_find_data(*head, data, DLL_FORWARD);
+    return dll_find_data_organize(head, data, (list_organize)policy);
+}
+
+void benchmark_single_list(const int *inserted, const int *lookups, int policy)
+{
+    sll_node *head = NULL;
+    size_t found = 0;
+    size_t visited = 0;
+    clock_t then;
+    long ms;
+    size_t i;
+    int k;
+
+    // Time the lookups on one list...
+    for (k = 0; k < KEY_COUNT; ++k)
+        sll_append_data(&head, inserted[k]);
+
+    then = clock();
+    for (i = 0; i < LOOKUP_COUNT; ++i)
+        found += sll_lookup(&head, lookups[i], policy) != NULL;
+    ms = elapsed_ms(then);
+    sll_erase(&head);
+
+    // ...and count the nodes they visit on another, outside the timing.
+    for (k = 0; k < KEY_COUNT; ++k)
+        sll_append_data(&head, inserted[k]);
+
+    for (i = 0; i < LOOKUP_COUNT; ++i)
+    {
+        sll_node *node;
+
+        for (node = head; node != NULL; node = node->next)
+        {
+            ++visited;
+            if (node->data == lookups[i])
+                break;
+        }
+        sll_lookup(&head, lookups[i], policy);
+    }
+    sll_erase(&head);
+
+    printf("  %-16s %6ld ms %9.1f nodes per find\n",
+           policy_name(policy), ms, (double)visited / LOOKUP_COUNT);
+    if (found != LOOKUP_COUNT)
+        printf("  Missed %lu lookups!\n", (unsigned long)(LOOKUP_COUNT - found));
+}
+
+void benchmark_double_list(const int *inserted, const int *lookups, int policy)
+{
+    dll_node *head = NULL;
+    size_t found = 0;
+    size_t visited = 0;
+    clock_t then;
+    long ms;
+    size_t i;
+    int k;
+
+    for (k = 0; k < KEY_COUNT; ++k)
+        dll_append_data(&head, inserted[k]);
+
+    then = clock();
+    for (i = 0; i < LOOKUP_COUNT; ++i)
+        found += dll_lookup(&head, lookups[i], policy) != NULL;
+    ms = elapsed_ms(then);
+    dll_erase(&head);
+
+    for (k = 0; k < KEY_COUNT; ++k)
+        dll_append_data(&head, inserted[k]);
+
+    for (i = 0; i < LOOKUP_COUNT; ++i)
+    {
+        dll_node *node;
+
+        for (node = head; node != NULL; node = node->next)
+        {
+            ++visited;
+            if (node->data == lookups[i])
+                break;
+        }
+        dll_lookup(&head, lookups[i], policy);
+    }
+    dll_erase(&head);
+
+    printf("  %-16s %6ld ms %9.1f nodes per find\n",
+           policy_name(policy), ms, (double)visited / LOOKUP_COUNT);
+    if (found != LOOKUP_COUNT)
+        printf("  Missed %lu lookups!\n", (unsigned long)(LOOKUP_COUNT - found));
+}
+
+int main(void)
+{
+    static const int policies[] = {
+        NO_POLICY, LIST_MOVE_TO_FRONT, LIST_TRANSPOSE, LIST_FREQUENCY_COUNT
+    };
+    int inserted[KEY_COUNT];
+    int by_popularity[KEY_COUNT];
+    int *lookups = (int *)malloc(LOOKUP_COUNT * sizeof(int));
+    size_t p;
+
+    if (lookups == NULL)
+    {
+        printf("Failed to allocate memory.\n");
+        return EXIT_FAILURE;
+    }
+
+    // The popularity of a key is unrelated to where it was inserted.
+    make_permutation(inserted, KEY_COUNT);
+    make_permutation(by_popularity, KEY_COUNT);
+    make_zipf_lookups(lookups, by_popularity);
+
+    printf("%d Zipf-distributed lookups (s = %.1f) among %d keys\n",
+           LOOKUP_COUNT, ZIPF_EXPONENT, KEY_COUNT);
+
+    printf("\nSingly-linked list\n");
+    for (p = 0; p < sizeof(policies) / sizeof(policies[0]); ++p)
+        benchmark_single_list(inserted, lookups, policies[p]);
+
+    printf("\nDoubly-linked list\n");
+    for (p = 0; p < sizeof(policies) / sizeof(policies[0]); ++p)
+        benchmark_double_list(inserted, lookups, policies[p]);
+
+    free(lookups);
+
+    return 0;
+}
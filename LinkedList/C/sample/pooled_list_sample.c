@@ -0,0 +1,130 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../double_linked_list.h"
+#include "../pooled_double_list.h"
+
+#define ELEMENT_COUNT   10000000
+
+// Helper function to display the processor time used since a starting point.
+void print_elapsed(const char *what, clock_t then)
+{
+    clock_t now = clock();
+
+    printf("  %s took about %ld milliseconds\n",
+           what, (long)((now - then) * 1000 / CLOCKS_PER_SEC));
+}
+
+void traverse_pooled_list(const pooled_double_list *list)
+{
+    printf("\nTraversing pooled list\n");
+
+    for (pdl_index node = list->head; node != PDL_NIL; node = list->next[node])
+        printf("Node index = %u, Data = %d, next = %d\n",
+               (unsigned)node, list->data[node],
+               list->next[node] == PDL_NIL ? -1 : (int)list->next[node]);
+
+    printf("%zu nodes in the list\n", pdl_size(list));
+}
+
+void demonstrate_pooled_list(void)
+{
+    pooled_double_list *list = pdl_create(0);
+    pooled_double_list *copy;
+    pdl_index node;
+
+    // The same operations as the doubly-linked list.
+    pdl_append_data(list, 42);
+    pdl_append_data(list, 123);
+    pdl_prepend_data(list, 67);
+    node = pdl_insert_data_after(list, pdl_find_data(list, list->head, 42, PDL_FORWARD), 1001);
+    pdl_insert_data_before(list, node, 2002);
+    traverse_pooled_list(list);
+
+    // Removing a node leaves its slot to be freed or reused.
+    node = pdl_find_data(list, list->tail, 42, PDL_BACKWARD);
+    pdl_remove_node(list, node);
+    pdl_free_node(list, node);
+    traverse_pooled_list(list);
+
+    // The whole list can be copied as plain memory.
+    copy = pdl_clone(list);
+    printf("\nThe copy holds %zu nodes and 1001 is in node %u\n",
+           pdl_size(copy), (unsigned)pdl_find_data_unordered(copy, 1001));
+
+    pdl_delete(copy);
+    pdl_delete(list);
+}
+
+void benchmark_double_linked_list(void)
+{
+    dll_node *head = NULL;
+    dll_node *last = NULL;
+    dll_node *found;
+    clock_t then;
+
+    printf("\ndll_node, %d elements\n", ELEMENT_COUNT);
+
+    then = clock();
+    last = dll_append_data(&head, 0);
+    for (int i=1; i < ELEMENT_COUNT; i++)
+        last = dll_insert_data_after(last, i);
+    print_elapsed("appending", then);
+
+    then = clock();
+    found = dll_find_data(head, -1, DLL_FORWARD);
+    print_elapsed("an unsuccessful find", then);
+
+    then = clock();
+    dll_erase(&head);
+    print_elapsed("erasing", then);
+
+    printf("  about %zu bytes per node, plus allocator overhead\n", sizeof(dll_node));
+
+    if (found != NULL)
+        printf("Unexpected result!\n");
+}
+
+void benchmark_pooled_list(void)
+{
+    pooled_double_list *list = pdl_create(0);
+    pdl_index found;
+    pdl_index found_unordered;
+    clock_t then;
+
+    printf("\npooled_double_list, %d elements\n", ELEMENT_COUNT);
+
+    then = clock();
+    for (int i=0; i < ELEMENT_COUNT; i++)
+        pdl_append_data(list, i);
+    print_elapsed("appending", then);
+
+    then = clock();
+    found = pdl_find_data(list, list->head, -1, PDL_FORWARD);
+    print_elapsed("an unsuccessful find, in list order", then);
+
+    then = clock();
+    found_unordered = pdl_find_data_unordered(list, -1);
+    print_elapsed("an unsuccessful find, scanning the data array", then);
+
+    printf("  %zu bytes per node\n", sizeof(int) + 2 * sizeof(pdl_index));
+
+    then = clock();
+    pdl_delete(list);
+    print_elapsed("deleting", then);
+
+    if (found != PDL_NIL || found_unordered != PDL_NIL)
+        printf("Unexpected result!\n");
+}
+
+int main(void)
+{
+    demonstrate_pooled_list();
+    benchmark_double_linked_list();
+    benchmark_pooled_list();
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../single_linked_list.h"
+#include "../double_linked_list.h"
+#include "../pooled_double_list.h"
+
+#define ELEMENT_COUNT   2000000
+#define REPETITIONS     5
+
+// Helper function to compute the processor time used since a starting point.
+long elapsed_ms(clock_t then)
+{
+    return (long)((clock() - then) * 1000 / CLOCKS_PER_SEC);
+}
+
+// A small generator, so that the shuffle is the same on every platform.
+static unsigned long long random_state = 88172645463325252ULL;
+
+size_t random_below(size_t limit)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return (size_t)(random_state % limit);
+}
+
+// Fill an array with a random permutation of 0 .. count-1.
+void make_permutation(size_t *order, size_t count)
+{
+    size_t i;
+
+    for (i = 0; i < count; ++i)
+        order[i] = i;
+    for (i = count - 1; i > 0; --i)
+    {
+        size_t j = random_below(i + 1);
+        size_t t = order[i];
+
+        order[i] = order[j];
+        order[j] = t;
+    }
+}
+
+// Build a singly-linked list whose nodes are linked in a different order
+// from the order in which they were allocated, so that following the list
+// jumps around in memory.
+sll_node *build_shuffled_single_list(const size_t *order)
+{
+    sll_node **nodes = (sll_node **)malloc(ELEMENT_COUNT * sizeof(sll_node *));
+    sll_node *head = NULL;
+    size_t i;
+
+    for (i = 0; i < ELEMENT_COUNT; ++i)
+        nodes[i] = sll_create_node((int)i);
+    for (i = ELEMENT_COUNT; i > 0; --i)
+        sll_prepend_node(&head, nodes[order[i - 1]]);
+
+    free(nodes);
+    return head;
+}
+
+dll_node *build_shuffled_double_list(const size_t *order)
+{
+    dll_node **nodes = (dll_node **)malloc(ELEMENT_COUNT * sizeof(dll_node *));
+    dll_node *head = NULL;
+    size_t i;
+
+    for (i = 0; i < ELEMENT_COUNT; ++i)
+        nodes[i] = dll_create_node((int)i);
+    for (i = ELEMENT_COUNT; i > 0; --i)
+        dll_prepend_node(&head, nodes[order[i - 1]]);
+
+    free(nodes);
+    return head;
+}
+
+pooled_double_list *build_shuffled_pooled_list(const size_t *order)
+{
+    pooled_double_list *list = pdl_create(ELEMENT_COUNT);
+    size_t i;
+
+    for (i = 0; i < ELEMENT_COUNT; ++i)
+        pdl_create_node(list, (int)i);
+    for (i = 0; i < ELEMENT_COUNT; ++i)
+        pdl_append_node(list, (pdl_index)order[i]);
+
+    return list;
+}
+
+void benchmark_single_list(const size_t *order)
+{
+    sll_node *head = build_shuffled_single_list(order);
+    clock_t then;
+    int found = 0;
+    int r;
+
+    // Searching for a value that is not present visits every node.
+    then = clock();
+    for (r = 0; r < REPETITIONS; ++r)
+        found += sll_find_data(head, -1) != NULL;
+    printf("  sll_find_data:           %ld ms\n", elapsed_ms(then));
+
+    then = clock();
+    for (r = 0; r < REPETITIONS; ++r)
+        found += sll_find_data_prefetch(head, -1) != NULL;
+    printf("  sll_find_data_prefetch:  %ld ms\n", elapsed_ms(then));
+
+    then = clock();
+    sll_erase(&head);
+    printf("  sll_erase:               %ld ms\n", elapsed_ms(then));
+
+    head = build_shuffled_single_list(order);
+    then = clock();
+    sll_erase_prefetch(&head);
+    printf("  sll_erase_prefetch:      %ld ms\n", elapsed_ms(then));
+
+    if (found)
+        printf("  Found a value that is not in the list!\n");
+}
+
+void benchmark_double_list(const size_t *order)
+{
+    dll_node *head = build_shuffled_double_list(order);
+    dll_node *tail = dll_find_tail_node(head);
+    clock_t then;
+    int found = 0;
+    int r;
+
+    then = clock();
+    for (r = 0; r < REPETITIONS; ++r)
+        found += dll_find_data(tail, -1, DLL_BACKWARD) != NULL;
+    printf("  dll_find_data:           %ld ms\n", elapsed_ms(then));
+
+    then = clock();
+    for (r = 0; r < REPETITIONS; ++r)
+        found += dll_find_data_prefetch(tail, -1, DLL_BACKWARD) != NULL;
+    printf("  dll_find_data_prefetch:  %ld ms\n", elapsed_ms(then));
+
+    then = clock();
+    dll_erase(&head);
+    printf("  dll_erase:               %ld ms\n", elapsed_ms(then));
+
+    head = build_shuffled_double_list(order);
+    then = clock();
+    dll_erase_prefetch(&head);
+    printf("  dll_erase_prefetch:      %ld ms\n", elapsed_ms(then));
+
+    if (found)
+        printf("  Found a value that is not in the list!\n");
+}
+
+void benchmark_pooled_list(const size_t *order)
+{
+    pooled_double_list *list = build_shuffled_pooled_list(order);
+    clock_t then;
+    int found = 0;
+    int r;
+
+    then = clock();
+    for (r = 0; r < REPETITIONS; ++r)
+        found += pdl_find_data(list, list->head, -1, PDL_FORWARD) != PDL_NIL;
+    printf("  pdl_find_data:           %ld ms\n", elapsed_ms(then));
+
+    then = clock();
+    for (r = 0; r < REPETITIONS; ++r)
+        found += pdl_find_data_prefetch(list, list->head, -1, PDL_FORWARD) != PDL_NIL;
+    printf("  pdl_find_data_prefetch:  %ld ms\n", elapsed_ms(then));
+
+    pdl_delete(list);
+
+    if (found)
+        printf("  Found a value that is not in the list!\n");
+}
+
+int main(void)
+{
+    size_t *order = (size_t *)malloc(ELEMENT_COUNT * sizeof(size_t));
+
+    if (order == NULL)
+    {
+        printf("Failed to allocate memory.\n");
+        return EXIT_FAILURE;
+    }
+
+    make_permutation(order, ELEMENT_COUNT);
+
+    printf("Lists of %d nodes linked in random order, %d full searches each\n",
+           ELEMENT_COUNT, REPETITIONS);
+    printf("\nSingly-linked list\n");
+    benchmark_single_list(order);
+    printf("\nDoubly-linked list\n");
+    benchmark_double_list(order);
+    printf("\nPooled doubly-linked list\n");
+    benchmark_pooled_list(order);
+
+    free(order);
+
+    return 0;
+}
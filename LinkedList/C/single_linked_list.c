@@ -3,10 +3,22 @@
 /// \author Jeffrey K. Bienstadt
 /// \copyright  Copyright (c) 2019--2023 Jeffrey K. Bienstadt
 
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h> // for malloc/free
 
+#include "list_prefetch.h"
 #include "single_linked_list.h"
 
+// Counters for the sll_* functions, updated only when DS_ENABLE_STATS is
+// defined.
+static list_stats sll_stats;
+
+// Number of data items copied through the buffer used by sll_serialize and
+// sll_deserialize.
+#define SLL_STREAM_CHUNK   1024
+
 /// \brief  Creates a new singly-linked list node populated with the specified data.
 /// \param data The data to be carried by the new node.
 /// \return A pointer to a new sll_node structure.
@@ -25,11 +37,39 @@ sll_node *sll_create_node(int data)
     {
         node->next = NULL;
         node->data = data;
+        node->hits = 0;
+        DS_LIST_STATS(list_stats_record_allocation(&sll_stats, sizeof(sll_node));)
     }
 
     return node;
 }
 
+/// \brief  Creates a new singly-linked list node populated with the specified data,
+///         obtaining its memory from a caller-supplied allocator.
+/// \param allocate A function that allocates the node's memory.
+/// \param context  The opaque pointer passed to \p allocate, such as an arena.
+/// \param data     The data to be carried by the new node.
+/// \return A pointer to a new sll_node structure, or NULL if the allocator could not
+///         obtain memory.
+///
+/// The allocator is expected to reclaim its nodes all at once. With an
+/// arena, for example, passing arena_allocate and the arena, a list is torn
+/// down by resetting or deleting the arena, whatever the length of the
+/// list, and then setting the list's head pointer to NULL. Such nodes must
+/// not be passed to sll_remove_node_after, sll_remove_node or sll_erase.
+sll_node *sll_create_node_from(list_allocate_fn allocate, void *context, int data)
+{
+    sll_node *node = (sll_node *)allocate(context, sizeof(sll_node));
+
+    if (node != NULL)
+    {
+        node->next = NULL;
+        node->data = data;
+        node->hits = 0;
+    }
+
+    return node;
+}
 /// \brief  Searches a linked list for a node that contains the specified data.
 /// \param start    A pointer to the node of the linked list to begin the search.
 /// \param data     The data to find.
@@ -37,16 +77,146 @@ sll_node *sll_create_node(int data)
 ///         desired data. On failure returns NULL.
 sll_node *sll_find_data(sll_node *start, int data)
 {
+    DS_LIST_STATS(uint64_t probes = 0;)
+
     while (start != NULL)
     {
+        DS_LIST_STATS(++probes;)
         if (start->data == data)
             break;
         start = start->next;
     }
 
+    DS_LIST_STATS(list_stats_record_find(&sll_stats, probes);)
     return start;
 }
 
+/// \brief  Searches a linked list for a node that contains the specified
+///         data, prefetching nodes ahead of the one being examined.
+/// \param start    A pointer to the node of the linked list to begin the search.
+/// \param data     The data to find.
+/// \return On success returns a pointer to the first node containing the
+///         desired data. On failure returns NULL.
+/// \remark While a node is examined, the node two places ahead is
+///         prefetched, so the load of each \c next pointer overlaps with the
+///         work on the node before it. This helps most when the nodes are
+///         scattered in memory.
+sll_node *sll_find_data_prefetch(sll_node *start, int data)
+{
+    DS_LIST_STATS(uint64_t probes = 0;)
+
+    if (start != NULL)
+        DS_PREFETCH(start->next);
+
+    while (start != NULL)
+    {
+        sll_node *next = start->next;
+
+        if (next != NULL)
+            DS_PREFETCH(next->next);
+
+        DS_LIST_STATS(++probes;)
+        if (start->data == data)
+            break;
+        start = next;
+    }
+
+    DS_LIST_STATS(list_stats_record_find(&sll_stats, probes);)
+    return start;
+}
+
+/// \brief  Searches a linked list for a node that contains the specified
+///         data, and rearranges the list so that frequently sought data
+///         moves towards the head.
+/// \param head     A pointer to pointer to the head node of the linked list.
+/// \param data     The data to find.
+/// \param policy   How the list is rearranged when the data is found.
+/// \return On success returns a pointer to the first node containing the
+///         desired data. On failure returns NULL, and the list is unchanged.
+/// \remark The \p head parameter is a pointer to pointer. This is because the
+///         node found may become the new head of the list.
+/// \remark LIST_FREQUENCY_COUNT keeps the nodes in decreasing order of the
+///         counts in their \c hits members, which it alone updates; the
+///         other policies and the other functions leave the counts alone.
+sll_node *sll_find_data_organize(sll_node **head, int data, list_organize policy)
+{
+    sll_node *before_previous = NULL;
+    sll_node *previous = NULL;
+    sll_node *current = *head;
+    DS_LIST_STATS(uint64_t probes = 0;)
+
+    while (current != NULL)
+    {
+        DS_LIST_STATS(++probes;)
+        if (current->data == data)
+            break;
+        before_previous = previous;
+        previous = current;
+        current = current->next;
+    }
+
+    DS_LIST_STATS(list_stats_record_find(&sll_stats, probes);)
+
+    if (current == NULL || previous == NULL)
+    {
+        // Not found, or found at the head where it cannot move any further.
+        if (current != NULL && policy == LIST_FREQUENCY_COUNT && current->hits != UINT_MAX)
+            ++current->hits;
+        return current;
+    }
+
+    switch (policy)
+    {
+        case LIST_MOVE_TO_FRONT:
+            previous->next = current->next;
+            current->next = *head;
+            *head = current;
+            break;
+
+        case LIST_TRANSPOSE:
+            previous->next = current->next;
+            current->next = previous;
+            if (before_previous == NULL)
+                *head = current;
+            else
+                before_previous->next = current;
+            break;
+
+        case LIST_FREQUENCY_COUNT:
+        {
+            // Find the first node with a lower count, which can only be
+            // ahead of the node found.
+            sll_node *before = NULL;
+            sll_node *scan = *head;
+
+            if (current->hits != UINT_MAX)
+                ++current->hits;
+
+            while (scan != current && scan->hits >= current->hits)
+            {
+                before = scan;
+                scan = scan->next;
+            }
+
+            if (scan != current)
+            {
+                previous->next = current->next;
+                current->next = scan;
+                if (before == NULL)
+                    *head = current;
+                else
+                    before->next = current;
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    return current;
+}
+
 /// \brief  Traverses the linked list until the tail node (the last node in
 ///         the list) is found.
 /// \param start A pointer to the node from which to begin the search.
@@ -156,6 +326,7 @@ sll_node *sll_remove_node_after(sll_node *node)
 
         node->next = next->next;
         free(next);
+        DS_LIST_STATS(list_stats_record_free(&sll_stats);)
     }
 
     return node->next;
@@ -175,20 +346,28 @@ sll_node *sll_remove_node(sll_node **head, sll_node *node)
     {
         *head = node->next;
         free(node);
+        DS_LIST_STATS(list_stats_record_free(&sll_stats);)
         return *head;
     }
     else
     {
         sll_node *previous = *head;
+        DS_LIST_STATS(uint64_t probes = 0;)
 
         // Traverse the list looking for the node previous to the desired node.
         while (previous != NULL)
         {
+            DS_LIST_STATS(++probes;)
             if (previous->next == node)
-                return sll_remove_node_after(node);
+            {
+                DS_LIST_STATS(list_stats_record_remove_scan(&sll_stats, probes);)
+                return sll_remove_node_after(previous);
+            }
 
             previous = previous->next;
         }
+
+        DS_LIST_STATS(list_stats_record_remove_scan(&sll_stats, probes);)
     }
 
     // No previous node was found.
@@ -209,8 +388,166 @@ void sll_erase(sll_node **head)
         sll_node *next = current->next;
 
         free(current);
+        DS_LIST_STATS(list_stats_record_free(&sll_stats);)
         current = next;
     }
 
     *head = NULL;
 }
+
+/// \brief  Erases an entire linked list, prefetching nodes ahead of the one
+///         being freed.
+/// \param head A pointer to pointer to the head node of the linked list.
+/// \remark Behaves like sll_erase, but while each node is freed the node two
+///         places ahead is prefetched.
+void sll_erase_prefetch(sll_node **head)
+{
+    sll_node *current = *head;
+
+    if (current != NULL)
+        DS_PREFETCH(current->next);
+
+    while (current != NULL)
+    {
+        sll_node *next = current->next;
+
+        if (next != NULL)
+            DS_PREFETCH(next->next);
+
+        free(current);
+        DS_LIST_STATS(list_stats_record_free(&sll_stats);)
+        current = next;
+    }
+
+    *head = NULL;
+}
+
+/// \brief  Writes a linked list to a stream in a binary format.
+/// \param head A pointer to the head node of the linked list.
+/// \param out  The stream to which the list is written, opened in binary mode.
+/// \return Non-zero on success, zero if the list could not be written.
+/// \remark The data is written in list order, preceded by a header giving
+///         the size of each data item and the number of items, in
+///         length-prefixed chunks that are copied through a fixed-size buffer:
+///
+///             uint32  size of each data item
+///             uint64  number of items
+///             repeated until all items have been written:
+///                 uint32  number of items in this chunk
+///                 the items of the chunk
+///
+///         Integers are stored in the native byte order of the machine.
+int sll_serialize(const sll_node *head, FILE *out)
+{
+    int buffer[SLL_STREAM_CHUNK];
+    uint32_t item_size = (uint32_t)sizeof(int);
+    uint64_t count = 0;
+    const sll_node *current;
+
+    for (current = head; current != NULL; current = current->next)
+        ++count;
+
+    if (fwrite(&item_size, sizeof(item_size), 1, out) != 1
+        || fwrite(&count, sizeof(count), 1, out) != 1)
+        return 0;
+
+    current = head;
+    while (current != NULL)
+    {
+        uint32_t used = 0;
+
+        for (; used < SLL_STREAM_CHUNK && current != NULL; ++used, current = current->next)
+            buffer[used] = current->data;
+
+        if (fwrite(&used, sizeof(used), 1, out) != 1
+            || fwrite(buffer, sizeof(int), used, out) != used)
+            return 0;
+    }
+
+    return 1;
+}
+
+/// \brief  Replaces a linked list with a list read from a stream written by
+///         sll_serialize.
+/// \param head A pointer to pointer to the head node of the linked list.
+/// \param in   The stream from which the list is read, opened in binary mode.
+/// \return Non-zero on success, zero if a complete list could not be read.
+///         On failure the list holds the items read before the error.
+/// \remark The \p head parameter is a pointer to pointer. This is because the
+///         existing list is erased and a new head node is created.
+int sll_deserialize(sll_node **head, FILE *in)
+{
+    int buffer[SLL_STREAM_CHUNK];
+    uint32_t item_size;
+    uint64_t count;
+    sll_node *tail = NULL;
+
+    sll_erase(head);
+
+    if (fread(&item_size, sizeof(item_size), 1, in) != 1
+        || item_size != sizeof(int)
+        || fread(&count, sizeof(count), 1, in) != 1)
+        return 0;
+
+    while (count > 0)
+    {
+        uint32_t length;
+
+        if (fread(&length, sizeof(length), 1, in) != 1 || length == 0 || length > count)
+            return 0;
+
+        count -= length;
+
+        // The chunk may have been written with a larger buffer than ours,
+        // so it is read in pieces no larger than our buffer.
+        while (length > 0)
+        {
+            uint32_t piece = length < SLL_STREAM_CHUNK ? length : SLL_STREAM_CHUNK;
+
+            if (fread(buffer, sizeof(int), piece, in) != piece)
+                return 0;
+
+            for (uint32_t i = 0; i < piece; ++i)
+            {
+                sll_node *node = sll_create_node(buffer[i]);
+
+                if (node == NULL)
+                    return 0;
+
+                if (tail == NULL)
+                    *head = node;
+                else
+                    tail->next = node;
+                tail = node;
+            }
+
+            length -= piece;
+        }
+    }
+
+    return 1;
+}
+
+/// \brief  Retrieves the counters describing the activity of the sll_*
+///         functions.
+/// \param stats    A pointer to the structure that receives the counters.
+/// \remark The counters are updated only when the library is built with
+///         DS_ENABLE_STATS defined; otherwise they are all zero.
+void sll_get_stats(list_stats *stats)
+{
+    *stats = sll_stats;
+}
+
+/// \brief  Resets the counters describing the activity of the sll_*
+///         functions to zero.
+/// \remark The number of live nodes is preserved so that it remains correct
+///         for nodes allocated before the reset.
+void sll_reset_stats(void)
+{
+    uint64_t live_nodes = sll_stats.live_nodes;
+    list_stats empty = {0};
+
+    sll_stats = empty;
+    sll_stats.live_nodes = live_nodes;
+    sll_stats.peak_live_nodes = live_nodes;
+}
@@ -6,6 +6,12 @@
 #ifndef INC_SINGLE_LINKED_LIST_H
 #define INC_SINGLE_LINKED_LIST_H
 
+#include <stdio.h>
+
+#include "list_allocator.h"
+#include "list_organize.h"
+#include "list_stats.h"
+
 /// \brief  The singly-linked list node structure.
 ///
 /// This structure is the core of the singly-linked list,
@@ -14,11 +20,15 @@
 typedef struct _sll_node
 {
     int data;               ///< The data stored in the linked list.
+    unsigned int hits;      ///< Lookups counted by LIST_FREQUENCY_COUNT searches.
     struct _sll_node *next; ///< Pointer to tne next node in the list.
 } sll_node;
 
 sll_node *sll_create_node(int data);
+sll_node *sll_create_node_from(list_allocate_fn allocate, void *context, int data);
 sll_node *sll_find_data(sll_node *start, int data);
+sll_node *sll_find_data_prefetch(sll_node *start, int data);
+sll_node *sll_find_data_organize(sll_node **head, int data, list_organize policy);
 sll_node *sll_find_tail_node(sll_node *start);
 sll_node *sll_append_node(sll_node **head, sll_node *node);
 sll_node *sll_append_data(sll_node **head, int data);
@@ -29,5 +39,10 @@ sll_node *sll_prepend_data(sll_node **head, int data);
 sll_node *sll_remove_node_after(sll_node *node);
 sll_node *sll_remove_node(sll_node **head, sll_node *node);
 void sll_erase(sll_node **head);
+void sll_erase_prefetch(sll_node **head);
+int sll_serialize(const sll_node *head, FILE *out);
+int sll_deserialize(sll_node **head, FILE *in);
+void sll_get_stats(list_stats *stats);
+void sll_reset_stats(void);
 
 #endif  // INC_SINGLE_LINKED_LIST_H
@@ -0,0 +1,423 @@
+/// \file   PairingHeap.h
+/// \brief  Implementation of a pairing heap priority queue in C++.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_PAIRING_HEAP
+#define INC_PAIRING_HEAP
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+#include <utility>
+
+/// \brief  A meldable priority queue that supports changing the priority
+///         of an item already in it.
+///
+/// The items are held in a tree of linked nodes, each node pointing to its
+/// first child and to its next sibling, that is ordered as a heap: no node
+/// has a higher priority than its parent. The root is the top item. \c push
+/// and \c meld link a new tree under the root, or the root under it, in
+/// constant time. \c pop removes the root and combines its children in two
+/// passes, pairing them from left to right and then linking the pairs from
+/// right to left, which keeps the amortized cost logarithmic.
+///
+/// As with \c std::priority_queue, the top item is one that no other item
+/// compares greater than: with the default \c std::less the largest item is
+/// on top, and with \c std::greater the smallest.
+///
+/// \c push returns a pointer to the item's node. The node stays valid,
+/// even if its heap is melded into another, until the item is popped or
+/// erased, and is used to raise the item's priority with \c decrease_key or
+/// to remove it with \c erase.
+///
+/// \tparam T           The type of the items held by the heap.
+/// \tparam Compare     The ordering of the items' priorities.
+/// \tparam Allocator   The allocator from which the heap's nodes are
+///                     obtained. It is rebound to the node type.
+template<typename T, typename Compare = std::less<T>, typename Allocator = std::allocator<T>>
+class PairingHeap
+{
+public:
+    /// \brief  The heap node structure.
+    ///
+    /// Each node holds an item, a pointer to its first child and to its next
+    /// sibling, and a pointer back to its previous sibling or, for a first
+    /// child, to its parent, so that it can be cut from the tree in
+    /// constant time.
+    class node_t
+    {
+    private:
+        T       _data;              ///< Data contained in the node
+        node_t *_child{nullptr};    ///< Pointer to the first child
+        node_t *_sibling{nullptr};  ///< Pointer to the next sibling
+        node_t *_prev{nullptr};     ///< Pointer to the previous sibling or the parent
+
+    public:
+        template<typename... Args>
+        explicit node_t(Args &&...args)
+          : _data(std::forward<Args>(args)...)
+        {}
+
+        node_t(const node_t &) = delete;
+        node_t & operator=(const node_t &) = delete;
+
+        /// \brief  Return a reference to the node's data.
+        ///
+        /// The data cannot be changed in place, since that could break the
+        /// heap order; use \c decrease_key instead.
+        const T &data() const noexcept
+        {
+            return _data;
+        }
+
+        friend PairingHeap;
+    };
+
+    /// \brief  The type of the allocator used by the heap.
+    using allocator_type = Allocator;
+
+    /// \brief  Default-construct an empty PairingHeap.
+    PairingHeap() = default;
+
+    /// \brief  Construct an empty PairingHeap ordered by the given comparison.
+    explicit PairingHeap(const Compare &compare, const Allocator &allocator = Allocator())
+      : _compare(compare),
+        _allocator(allocator)
+    {
+    }
+
+    /// \brief  Construct an empty PairingHeap whose nodes are obtained from
+    ///         the given allocator.
+    explicit PairingHeap(const Allocator &allocator)
+      : _allocator(allocator)
+    {
+    }
+
+    PairingHeap(const PairingHeap &) = delete;
+    PairingHeap & operator=(const PairingHeap &) = delete;
+
+    /// \brief  Destroy a PairingHeap.
+    ///
+    /// Any contained nodes will be removed and their memory reclaimed.
+    ~PairingHeap()
+    {
+        clear();
+    }
+
+    /// \brief  Return the number of items in the heap.
+    size_t size() const noexcept
+    {
+        return _count;
+    }
+
+    /// \brief  Determine if the heap is empty.
+    ///
+    /// \return \c true if the heap is empty, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return _root == nullptr;
+    }
+
+    /// \brief  Access the top item of the heap.
+    ///
+    /// Calling \c top on an empty heap is an error.
+    const T &top() const
+    {
+        assert(!is_empty());
+        return _root->_data;
+    }
+
+    /// \brief  Return a pointer to the node holding the top item, or
+    ///         \c nullptr if the heap is empty.
+    node_t *top_node() const noexcept
+    {
+        return _root;
+    }
+
+    /// \brief  Add an item to the heap.
+    ///
+    /// \param data The item to be added.
+    /// \return A pointer to the new item's node.
+    node_t *push(const T &data)
+    {
+        return emplace(data);
+    }
+
+    /// \brief  Add an item to the heap.
+    ///
+    /// \param data The item to be moved into the heap.
+    /// \return A pointer to the new item's node.
+    node_t *push(T &&data)
+    {
+        return emplace(std::move(data));
+    }
+
+    /// \brief  Construct an item in place in the heap.
+    ///
+    /// \param args Arguments passed to the item's constructor.
+    /// \return A pointer to the new item's node.
+    template<typename... Args>
+    node_t *emplace(Args &&...args)
+    {
+        node_t *new_node{create_node(std::forward<Args>(args)...)};
+
+        _root = _root ? link(_root, new_node) : new_node;
+        ++_count;
+
+        return new_node;
+    }
+
+    /// \brief  Remove the top item from the heap.
+    ///
+    /// Calling \c pop on an empty heap is an error.
+    void pop()
+    {
+        assert(!is_empty());
+
+        node_t *old_root{_root};
+
+        _root = merge_pairs(old_root->_child);
+        destroy_node(old_root);
+        --_count;
+    }
+
+    /// \brief  Give an item a new value whose priority is no lower than its
+    ///         current one.
+    ///
+    /// \param node     The node holding the item, as returned by \c push.
+    /// \param data     The new value of the item. It must not compare less
+    ///                 than the current value.
+    ///
+    /// The node is cut from its parent together with its subtree, which is
+    /// then linked with the root.
+    void decrease_key(node_t *node, const T &data)
+    {
+        assert(node != nullptr && !_compare(data, node->_data));
+
+        node->_data = data;
+        if (node != _root)
+        {
+            cut(node);
+            _root = link(_root, node);
+        }
+    }
+
+    /// \brief  Remove an item from the heap.
+    ///
+    /// \param node     The node holding the item, as returned by \c push.
+    ///
+    /// The node's children are combined as if it were popped, and the
+    /// result linked with the root.
+    void erase(node_t *node)
+    {
+        assert(node != nullptr && !is_empty());
+
+        if (node == _root)
+        {
+            pop();
+            return;
+        }
+
+        cut(node);
+
+        node_t *children{merge_pairs(node->_child)};
+
+        if (children)
+            _root = link(_root, children);
+        destroy_node(node);
+        --_count;
+    }
+
+    /// \brief  Move every item of another heap into this one.
+    ///
+    /// \param other    The heap whose items are taken. It is left empty.
+    ///
+    /// The two roots are linked in constant time; no node is copied, so
+    /// pointers to the other heap's nodes become pointers into this heap.
+    /// The heaps' allocators must compare equal, since nodes are later
+    /// freed by the heap that holds them.
+    void meld(PairingHeap &other)
+    {
+        assert(_allocator == other._allocator);
+
+        if (&other == this || other.is_empty())
+            return;
+
+        _root = _root ? link(_root, other._root) : other._root;
+        _count += other._count;
+        other._root = nullptr;
+        other._count = 0;
+    }
+
+    /// \brief  Remove every item from the heap.
+    void clear() noexcept
+    {
+        // The nodes still to be freed are kept in a list threaded through
+        // their sibling pointers, so that no recursion is needed.
+        node_t *pending{_root};
+
+        while (pending)
+        {
+            node_t *node{pending};
+
+            pending = node->_sibling;
+            for (node_t *child = node->_child; child != nullptr;)
+            {
+                node_t *next{child->_sibling};
+
+                child->_sibling = pending;
+                pending = child;
+                child = next;
+            }
+            destroy_node(node);
+        }
+
+        _root = nullptr;
+        _count = 0;
+    }
+
+    /// \brief  Return a copy of the heap's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+private:
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node_t>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // Obtain a node from the allocator and construct it with the given data.
+    template<typename... Args>
+    node_t *create_node(Args &&...args)
+    {
+        node_t *new_node = node_traits::allocate(_allocator, 1);
+
+        try
+        {
+            node_traits::construct(_allocator, new_node, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, new_node, 1);
+            throw;
+        }
+
+        return new_node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node_t *old_node) noexcept
+    {
+        node_traits::destroy(_allocator, old_node);
+        node_traits::deallocate(_allocator, old_node, 1);
+    }
+
+    // Link two trees, neither of which has siblings, making the root with
+    // the lower priority the first child of the other. Return the root of
+    // the combined tree.
+    node_t *link(node_t *first, node_t *second) noexcept
+    {
+        if (_compare(first->_data, second->_data))
+            std::swap(first, second);
+
+        second->_sibling = first->_child;
+        if (first->_child)
+            first->_child->_prev = second;
+        second->_prev = first;
+        first->_child = second;
+
+        return first;
+    }
+
+    // Detach a node, with its subtree, from its parent and siblings.
+    void cut(node_t *node) noexcept
+    {
+        if (node->_prev->_child == node)
+            node->_prev->_child = node->_sibling;
+        else
+            node->_prev->_sibling = node->_sibling;
+
+        if (node->_sibling)
+            node->_sibling->_prev = node->_prev;
+
+        node->_sibling = nullptr;
+        node->_prev = nullptr;
+    }
+
+    // Combine a list of sibling trees into one, linking them in pairs from
+    // left to right and then linking the pairs from right to left. Return
+    // the root of the combined tree, or nullptr if the list is empty.
+    node_t *merge_pairs(node_t *first) noexcept
+    {
+        // The pairs are pushed on a stack threaded through their sibling
+        // pointers, which leaves the rightmost pair on top for the second
+        // pass.
+        node_t *pairs{nullptr};
+
+        while (first)
+        {
+            node_t *left{first};
+            node_t *right{left->_sibling};
+
+            left->_prev = nullptr;
+            if (right == nullptr)
+            {
+                left->_sibling = pairs;
+                pairs = left;
+                break;
+            }
+
+            first = right->_sibling;
+            left->_sibling = nullptr;
+            right->_sibling = nullptr;
+            right->_prev = nullptr;
+
+            node_t *pair{link(left, right)};
+
+            pair->_sibling = pairs;
+            pairs = pair;
+        }
+
+        if (pairs == nullptr)
+            return nullptr;
+
+        node_t *result{pairs};
+
+        pairs = pairs->_sibling;
+        result->_sibling = nullptr;
+        while (pairs)
+        {
+            node_t *next{pairs->_sibling};
+
+            pairs->_sibling = nullptr;
+            result = link(pairs, result);
+            pairs = next;
+        }
+
+        return result;
+    }
+
+    // Instance data
+    node_t         *_root{nullptr}; ///< Pointer to the root node, holding the top item
+    size_t          _count{0};      ///< Number of items in the heap
+    Compare         _compare;       ///< Ordering of the items' priorities
+    node_allocator  _allocator;     ///< Allocator from which nodes are obtained
+};
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  A PairingHeap whose nodes are obtained from a \c std::pmr::memory_resource.
+template<typename T, typename Compare = std::less<T>>
+using PairingHeap = ::PairingHeap<T, Compare, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
+#endif  // INC_PAIRING_HEAP
@@ -0,0 +1,257 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../PairingHeap.h"
+
+namespace {
+
+constexpr std::uint32_t vertex_count = 200000;
+constexpr std::uint32_t edges_per_vertex = 8;
+constexpr std::uint64_t unreachable = std::numeric_limits<std::uint64_t>::max();
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Apply random pushes, pops, priority changes, erasures and melds to two
+// pairing heaps, mirrored in a multiset, and check that the top items agree
+// throughout.
+bool check_against_multiset()
+{
+    using heap_type = PairingHeap<int, std::greater<int>>;
+
+    heap_type                                       heap;
+    heap_type                                       other;
+    std::multiset<int>                              reference;
+    std::vector<heap_type::node_t *>                nodes;
+    std::unordered_map<heap_type::node_t *, size_t> position;
+    std::mt19937_64                                 engine{2019};
+
+    // Drop a node that has left the heaps from the list of live nodes.
+    auto    forget = [&](heap_type::node_t *node)
+    {
+        size_t  index{position[node]};
+
+        nodes[index] = nodes.back();
+        position[nodes[index]] = index;
+        nodes.pop_back();
+        position.erase(node);
+    };
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        unsigned    choice{unsigned(engine() % 10)};
+
+        if (nodes.empty() || choice < 4)
+        {
+            int value{int(engine() % 1000000)};
+
+            auto   *node{(choice % 2 ? heap : other).push(value)};
+
+            position[node] = nodes.size();
+            nodes.push_back(node);
+            reference.insert(value);
+        }
+        else if (choice < 6)
+        {
+            auto   *node{nodes[engine() % nodes.size()]};
+            int     lower{node->data() - int(engine() % 1000)};
+
+            // The node may be in either heap, so meld them first.
+            heap.meld(other);
+            reference.erase(reference.find(node->data()));
+            reference.insert(lower);
+            heap.decrease_key(node, lower);
+        }
+        else if (choice < 8)
+        {
+            heap.meld(other);
+            if (heap.top() != *reference.begin())
+                return false;
+            reference.erase(reference.begin());
+            forget(heap.top_node());
+            heap.pop();
+        }
+        else
+        {
+            auto   *node{nodes[engine() % nodes.size()]};
+
+            heap.meld(other);
+            reference.erase(reference.find(node->data()));
+            forget(node);
+            heap.erase(node);
+        }
+
+        if (heap.size() + other.size() != reference.size())
+            return false;
+    }
+
+    heap.meld(other);
+    for (int value : reference)
+    {
+        if (heap.top() != value)
+            return false;
+        heap.pop();
+    }
+
+    return heap.is_empty();
+}
+
+// A directed graph with random edges and weights, stored as adjacency
+// arrays.
+struct Graph
+{
+    std::vector<std::uint32_t>  first_edge;
+    std::vector<std::uint32_t>  target;
+    std::vector<std::uint32_t>  weight;
+};
+
+Graph make_graph()
+{
+    Graph           graph;
+    std::mt19937_64 engine{42};
+
+    for (std::uint32_t v = 0; v < vertex_count; ++v)
+    {
+        graph.first_edge.push_back(std::uint32_t(graph.target.size()));
+        for (std::uint32_t e = 0; e < edges_per_vertex; ++e)
+        {
+            graph.target.push_back(std::uint32_t(engine() % vertex_count));
+            graph.weight.push_back(std::uint32_t(1 + engine() % 1000));
+        }
+    }
+    graph.first_edge.push_back(std::uint32_t(graph.target.size()));
+
+    return graph;
+}
+
+using entry = std::pair<std::uint64_t, std::uint32_t>;  // distance, vertex
+
+// Dijkstra's algorithm with std::priority_queue, which cannot change an
+// entry's priority: a shorter distance is pushed as a new entry, and stale
+// entries are skipped when they reach the top.
+std::vector<std::uint64_t> dijkstra_priority_queue(const Graph &graph, size_t &pushes)
+{
+    std::vector<std::uint64_t>  distance(vertex_count, unreachable);
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry>> queue;
+
+    distance[0] = 0;
+    queue.push({0, 0});
+    pushes = 1;
+    while (!queue.empty())
+    {
+        auto [d, v] = queue.top();
+
+        queue.pop();
+        if (d != distance[v])
+            continue;
+
+        for (std::uint32_t e = graph.first_edge[v]; e < graph.first_edge[v + 1]; ++e)
+        {
+            std::uint64_t   candidate{d + graph.weight[e]};
+            std::uint32_t   t{graph.target[e]};
+
+            if (candidate < distance[t])
+            {
+                distance[t] = candidate;
+                queue.push({candidate, t});
+                ++pushes;
+            }
+        }
+    }
+
+    return distance;
+}
+
+// Dijkstra's algorithm with PairingHeap: each vertex has at most one entry,
+// whose priority is raised with decrease_key when a shorter path is found.
+template<typename Heap>
+std::vector<std::uint64_t> dijkstra_pairing_heap(const Graph &graph, Heap &queue, size_t &decreases)
+{
+    std::vector<std::uint64_t>              distance(vertex_count, unreachable);
+    std::vector<typename Heap::node_t *>    node(vertex_count, nullptr);
+
+    distance[0] = 0;
+    node[0] = queue.push({0, 0});
+    decreases = 0;
+    while (!queue.is_empty())
+    {
+        auto [d, v] = queue.top();
+
+        queue.pop();
+        node[v] = nullptr;
+
+        for (std::uint32_t e = graph.first_edge[v]; e < graph.first_edge[v + 1]; ++e)
+        {
+            std::uint64_t   candidate{d + graph.weight[e]};
+            std::uint32_t   t{graph.target[e]};
+
+            if (candidate < distance[t])
+            {
+                distance[t] = candidate;
+                if (node[t])
+                {
+                    queue.decrease_key(node[t], {candidate, t});
+                    ++decreases;
+                }
+                else
+                {
+                    node[t] = queue.push({candidate, t});
+                }
+            }
+        }
+    }
+
+    return distance;
+}
+
+} // namespace
+
+int main()
+{
+    std::cout << "PairingHeap agrees with std::multiset: "
+              << (check_against_multiset() ? "yes" : "NO") << "\n\n";
+
+    Graph   graph{make_graph()};
+
+    std::cout << "Dijkstra's algorithm on a random graph of " << vertex_count << " vertices and "
+              << graph.target.size() << " edges\n";
+
+    size_t  pushes{0};
+    size_t  decreases{0};
+    auto    then{clock_type::now()};
+    auto    expected{dijkstra_priority_queue(graph, pushes)};
+
+    std::cout << "  std::priority_queue:    " << std::setw(6) << elapsed_ms(then) << " ms, "
+              << pushes << " pushes\n";
+
+    PairingHeap<entry, std::greater<entry>> heap;
+
+    then = clock_type::now();
+
+    auto    distances{dijkstra_pairing_heap(graph, heap, decreases)};
+
+    std::cout << "  PairingHeap:            " << std::setw(6) << elapsed_ms(then) << " ms, "
+              << decreases << " decrease_key calls\n";
+
+    if (distances != expected)
+        std::cout << "  The distances differ!\n";
+
+    return 0;
+}
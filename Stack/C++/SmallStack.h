@@ -0,0 +1,260 @@
+/// \file   SmallStack.h
+/// \brief  Implementation of a stack with inline storage for small sizes.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2022--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_SMALL_STACK
+#define INC_SMALL_STACK
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "StackStats.h"
+
+/// \brief  A stack that holds its first \c N items within the stack object
+///         itself, allocating heap storage only when it grows beyond that.
+///
+/// Unlike Stack, which allocates a node for every push, a SmallStack stores
+/// its items contiguously. While no more than \c N items have been pushed the
+/// items live in storage inside the object, so a short-lived stack declared
+/// as a local variable performs no allocation at all. When a push would
+/// exceed the current capacity the items are moved to a heap array twice the
+/// size; the heap storage is kept until the stack is destroyed.
+///
+/// \tparam T   The type of the items held by the stack.
+/// \tparam N   The number of items held in inline storage.
+template <typename T, size_t N>
+class SmallStack
+{
+    static_assert(N > 0, "A SmallStack must have room for at least one inline item");
+
+public:
+
+    /// \brief  Default-construct an empty SmallStack.
+    SmallStack() noexcept
+      : _size{0},
+        _capacity{N},
+        _data{inline_data()}
+    {
+    }
+
+    SmallStack(const SmallStack &) = delete;
+    SmallStack & operator=(const SmallStack &) = delete;
+
+    /// \brief  Destroy the stack, destroying its items and freeing any heap
+    ///         storage.
+    ~SmallStack()
+    {
+        clear();
+        if (!is_inline())
+        {
+            free_storage(_data);
+            DS_STACK_STATS(_stats.record_deallocation();)
+        }
+    }
+
+    /// \brief  Push a new value onto the stack.
+    ///
+    /// \param value    A \c const reference to the item to be pushed.
+    void push(const T &value)
+    {
+        if (_size == _capacity)
+            grow(value);
+        else
+            new (_data + _size) T(value);
+        ++_size;
+        DS_STACK_STATS(_stats.record_size(_size);)
+    }
+
+    /// \brief  Remove the item on the top of the stack.
+    void pop()
+    {
+        assert(!is_empty());
+
+        --_size;
+        _data[_size].~T();
+    }
+
+    /// \brief  Access the top item on the stack.
+    ///
+    /// \return A const reference to the top element in the stack.
+    ///
+    /// Calling \c top on an empty stack is an error.
+    const T &top() const
+    {
+        assert(!is_empty());
+        return _data[_size - 1];
+    }
+
+    /// \brief  Access the top item on the stack.
+    ///
+    /// \return A reference to the top element in the stack.
+    ///
+    /// Calling \c top on an empty stack is an error.
+    T &top()
+    {
+        assert(!is_empty());
+        return _data[_size - 1];
+    }
+
+    /// \brief  Determine if the stack is empty.
+    ///
+    /// \return \c true if the stack is empty, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /// \brief  Get the number of items currently on the stack.
+    ///
+    /// \return The number of items currently on the stack.
+    size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    /// \brief  Get the number of items the stack can hold before it must
+    ///         allocate more storage.
+    size_t capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    /// \brief  Determine if the items are held in the inline storage.
+    ///
+    /// \return \c true if the stack has never grown beyond \c N items,
+    ///         \c false if its items have been moved to heap storage.
+    bool is_inline() const noexcept
+    {
+        return _data == inline_data();
+    }
+
+    /// \brief  Return the stack's instrumentation counters.
+    ///
+    /// The counters are maintained only when DS_ENABLE_STATS is defined;
+    /// otherwise all of the counters are zero. Only heap allocations are
+    /// counted.
+    const StackStats &stats() const noexcept
+    {
+#if defined(DS_ENABLE_STATS)
+        return _stats;
+#else
+        static const StackStats no_stats{};
+        return no_stats;
+#endif
+    }
+
+    /// \brief  Reset the stack's instrumentation counters. The peak size
+    ///         restarts from the current size.
+    void reset_stats() noexcept
+    {
+        DS_STACK_STATS(_stats = StackStats{};)
+        DS_STACK_STATS(_stats.record_size(_size);)
+    }
+
+private:
+    using storage_t = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    T *inline_data() noexcept
+    {
+        return reinterpret_cast<T *>(_inline);
+    }
+
+    const T *inline_data() const noexcept
+    {
+        return reinterpret_cast<const T *>(_inline);
+    }
+
+    // Destroy all of the items, keeping the storage.
+    void clear() noexcept
+    {
+        while (_size > 0)
+            pop();
+    }
+
+    // Obtain uninitialized heap storage for the given number of items,
+    // aligned for type T even if it is over-aligned. Without C++17's
+    // aligned operator new, over-aligned types are rejected instead.
+    static T *allocate_storage(size_t capacity)
+    {
+#if defined(__cpp_aligned_new)
+        return static_cast<T *>(::operator new(capacity * sizeof(T), std::align_val_t{alignof(T)}));
+#else
+        static_assert(alignof(T) <= alignof(std::max_align_t),
+                      "Over-aligned items need the aligned operator new of C++17");
+        return static_cast<T *>(::operator new(capacity * sizeof(T)));
+#endif
+    }
+
+    // Free heap storage obtained from allocate_storage.
+    static void free_storage(T *data) noexcept
+    {
+#if defined(__cpp_aligned_new)
+        ::operator delete(data, std::align_val_t{alignof(T)});
+#else
+        ::operator delete(data);
+#endif
+    }
+
+    // Move the items to a heap array with twice the current capacity, and
+    // construct a copy of the value being pushed after them. The copy is
+    // made first, since the value may be one of the items being moved.
+    void grow(const T &value)
+    {
+        size_t  new_capacity{_capacity * 2};
+        T      *new_data{allocate_storage(new_capacity)};
+        size_t  moved{0};
+
+        DS_STACK_STATS(_stats.record_allocation(new_capacity * sizeof(T));)
+
+        try
+        {
+            new (new_data + _size) T(value);
+        }
+        catch (...)
+        {
+            free_storage(new_data);
+            DS_STACK_STATS(_stats.record_deallocation();)
+            throw;
+        }
+
+        try
+        {
+            for (; moved < _size; ++moved)
+                new (new_data + moved) T(std::move_if_noexcept(_data[moved]));
+        }
+        catch (...)
+        {
+            while (moved > 0)
+                new_data[--moved].~T();
+            new_data[_size].~T();
+            free_storage(new_data);
+            DS_STACK_STATS(_stats.record_deallocation();)
+            throw;
+        }
+
+        for (size_t i{0}; i < _size; ++i)
+            _data[i].~T();
+        if (!is_inline())
+        {
+            free_storage(_data);
+            DS_STACK_STATS(_stats.record_deallocation();)
+        }
+
+        _data = new_data;
+        _capacity = new_capacity;
+    }
+
+    size_t      _size;          // The current number of items in the stack.
+    size_t      _capacity;      // The number of items that fit in the current storage.
+    T          *_data;          // The current storage, inline or on the heap.
+    storage_t   _inline[N];     // Storage for the first N items.
+#if defined(DS_ENABLE_STATS)
+    StackStats  _stats;         // Instrumentation counters
+#endif
+};
+
+#endif  // INC_SMALL_STACK
@@ -7,13 +7,32 @@
 #define INC_STACK
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+#include <type_traits>
+
+#include "BulkRelease.h"
+#include "StackStats.h"
+#include "ListStream.h"
 
 /// \brief  An implementation of a stack, based on a singly-linked list.
-template <typename T>
+///
+/// \tparam T           The type of the items held by the stack.
+/// \tparam Allocator   The allocator from which the stack's nodes are
+///                     obtained. It is rebound to the node type.
+template <typename T, typename Allocator = std::allocator<T>>
 class Stack
 {
 public:
 
+    /// \brief  The type of the allocator used by the stack.
+    using allocator_type = Allocator;
+
     /// \brief  Default-construct an empty Stack.
     Stack()
       : _size{0},
@@ -21,15 +40,36 @@ public:
     {
     }
 
+    /// \brief  Construct an empty Stack whose nodes are obtained from the
+    ///         given allocator.
+    explicit Stack(const Allocator &allocator)
+      : _size{0},
+        _head{nullptr},
+        _allocator(allocator)
+    {
+    }
+
+    /// \brief  Construct a Stack holding the items in the range
+    ///         [\p first, \p last), pushed in order so that the last item
+    ///         is on top.
+    ///
+    /// \param first        Iterator to the first item to be pushed.
+    /// \param last         Iterator past the last item to be pushed.
+    /// \param allocator    The allocator from which nodes are obtained.
+    template<typename InputIt,
+             typename = typename std::iterator_traits<InputIt>::iterator_category>
+    Stack(InputIt first, InputIt last, const Allocator &allocator = Allocator())
+      : _size{0},
+        _head{nullptr},
+        _allocator(allocator)
+    {
+        push_range(first, last);
+    }
+
     /// \brief  Destroy the stack, deleting any data nodes in the linked list.
     ~Stack()
     {
-        while (_head)
-        {
-            node *new_head = _head->_next;
-            delete _head;
-            _head = new_head;
-        }
+        clear();
     }
 
     /// \brief  Push a new value onto the stack.
@@ -37,13 +77,15 @@ public:
     /// \param value    A \c const reference to the item to be pushed.
     void push(const T &value)
     {
-        node *new_head = new node(value);
+        node *new_head = create_node(value);
+        DS_STACK_STATS(_stats.record_allocation(sizeof(node));)
 
         // Prepend the new data node to the head of the list
         new_head->_next = _head;
         _head = new_head;
 
         ++_size;
+        DS_STACK_STATS(_stats.record_size(_size);)
     }
 
     /// \brief  Remove the item on the top of the stack.
@@ -54,8 +96,116 @@ public:
 
         // Remove the node at the head and make the next node the new head.
         _head = old_head->_next;
-        delete old_head;
+        destroy_node(old_head);
         --_size;
+        DS_STACK_STATS(_stats.record_deallocation();)
+    }
+
+    /// \brief  Push every item in the range [\p first, \p last) onto the
+    ///         stack, in order, so that the last item ends up on top.
+    ///
+    /// \param first    Iterator to the first item to be pushed.
+    /// \param last     Iterator past the last item to be pushed.
+    ///
+    /// The new nodes are linked into a chain of their own, which is then
+    /// placed on top of the stack in one step. The size and counters are
+    /// updated once for the whole range. If an item cannot be copied or a
+    /// node cannot be allocated, the nodes already created are destroyed and
+    /// the stack is left unchanged.
+    template<typename InputIt>
+    void push_range(InputIt first, InputIt last)
+    {
+        node   *chain_top{nullptr};
+        node   *chain_bottom{nullptr};
+        size_t  count{0};
+
+        try
+        {
+            for (; first != last; ++first, ++count)
+            {
+                node *new_node = create_node(*first);
+
+                new_node->_next = chain_top;
+                chain_top = new_node;
+                if (chain_bottom == nullptr)
+                    chain_bottom = new_node;
+            }
+        }
+        catch (...)
+        {
+            while (chain_top)
+            {
+                node *next = chain_top->_next;
+                destroy_node(chain_top);
+                chain_top = next;
+            }
+            throw;
+        }
+
+        if (chain_top == nullptr)
+            return;
+
+        chain_bottom->_next = _head;
+        _head = chain_top;
+        _size += count;
+        DS_STACK_STATS(_stats.record_allocation(sizeof(node), count);)
+        DS_STACK_STATS(_stats.record_size(_size);)
+    }
+
+    /// \brief  Pop up to \p count items off the stack, copying each to an
+    ///         output iterator before it is removed.
+    ///
+    /// \param count    The maximum number of items to pop.
+    /// \param out      The iterator to which the items are written, top item
+    ///                 first.
+    ///
+    /// \return The output iterator following the last item written.
+    ///
+    /// If the stack holds fewer than \p count items, it is emptied.
+    template<typename OutputIt>
+    OutputIt pop_n(size_t count, OutputIt out)
+    {
+        size_t  popped{0};
+
+        for (; popped < count && _head; ++popped)
+        {
+            node *old_head = _head;
+
+            *out = std::move(old_head->_data);
+            ++out;
+            _head = old_head->_next;
+            destroy_node(old_head);
+        }
+
+        _size -= popped;
+        DS_STACK_STATS(_stats.record_deallocation(popped);)
+
+        return out;
+    }
+
+    /// \brief  Visit every item from the top of the stack to the bottom,
+    ///         removing each as it is visited.
+    ///
+    /// \param visit    Function called with a reference to each item before
+    ///                 its node is freed.
+    ///
+    /// Each node is visited and freed in a single pass over the list, in
+    /// place of a \c top and \c pop call per item. The stack is empty when
+    /// \c drain returns. If \p visit throws an exception, the item it was
+    /// given and the items below it remain on the stack.
+    template<typename Visitor>
+    void drain(Visitor visit)
+    {
+        while (_head)
+        {
+            visit(_head->_data);
+
+            node *old_head = _head;
+            _head = old_head->_next;
+            destroy_node(old_head);
+            --_size;
+            DS_STACK_STATS(_stats.record_deallocation();)
+        }
     }
 
     /// \brief  Access the top item on the stack.
@@ -96,6 +246,137 @@ public:
         return _size;
     }
 
+    /// \brief  Abandon every item without visiting it, leaving the stack empty.
+    ///
+    /// The nodes are neither destroyed nor returned to the allocator, so the
+    /// cost does not depend on the size of the stack. This is intended for
+    /// stacks whose allocator draws from an arena, such as ArenaAllocator:
+    /// after \c release the arena can be reset to reclaim every node at once.
+    /// It compiles only for allocators marked by \c releases_in_bulk, since
+    /// with any other allocator the nodes' memory would be leaked.
+    ///
+    /// \remark Type \c T must be trivially destructible.
+    void release() noexcept
+    {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "Only nodes holding trivially destructible items can be released");
+        static_assert(releases_in_bulk<Allocator>::value,
+                      "Only nodes from an allocator that frees them in bulk can be released");
+
+        DS_STACK_STATS(_stats.record_deallocation(_size);)
+
+        _head = nullptr;
+        _size = 0;
+    }
+
+    /// \brief  Return a copy of the stack's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_allocator);
+    }
+
+    /// \brief  Return the stack's instrumentation counters.
+    ///
+    /// The counters are maintained only when DS_ENABLE_STATS is defined;
+    /// otherwise all of the counters are zero.
+    const StackStats &stats() const noexcept
+    {
+#if defined(DS_ENABLE_STATS)
+        return _stats;
+#else
+        static const StackStats no_stats{};
+        return no_stats;
+#endif
+    }
+
+    /// \brief  Reset the stack's instrumentation counters. The peak size
+    ///         restarts from the current size.
+    void reset_stats() noexcept
+    {
+        DS_STACK_STATS(_stats = StackStats{};)
+        DS_STACK_STATS(_stats.record_size(_size);)
+    }
+
+    /// \brief  Write the stack to a stream in a binary format.
+    ///
+    /// \param writer   The destination, such as a \c std::ostream opened in
+    ///                 binary mode. Any object with a
+    ///                 \c write(const char *, std::streamsize) member and a
+    ///                 conversion to \c bool reporting its state may be used.
+    ///
+    /// \return \c true if the stack was written successfully, \c false otherwise.
+    ///
+    /// The items are written from the top of the stack to the bottom,
+    /// preceded by a header giving the item size and count, in
+    /// length-prefixed chunks that are streamed through a fixed-size buffer:
+    ///
+    ///     uint32  item size, or zero if the items are custom-encoded
+    ///     uint64  number of items
+    ///     repeated until all items have been written:
+    ///         uint32  number of items in this chunk
+    ///         the items of the chunk
+    ///
+    /// \remark Type \c T must be trivially copyable. Other types can be
+    ///         written with the overload that takes an encoder.
+    template<typename Writer>
+    bool serialize(Writer &writer) const
+    {
+        return list_stream::write<T>(writer, static_cast<const node *>(_head), _size);
+    }
+
+    /// \brief  Write the stack to a stream, encoding each item with a
+    ///         caller-supplied function.
+    ///
+    /// \param writer   The destination of the serialized stack.
+    /// \param encode   Function called as \c encode(writer, item) for each
+    ///                 item, returning \c false on failure.
+    ///
+    /// \return \c true if the stack was written successfully, \c false otherwise.
+    template<typename Writer, typename Encoder>
+    bool serialize(Writer &writer, Encoder encode) const
+    {
+        return list_stream::write(writer, static_cast<const node *>(_head), _size, encode);
+    }
+
+    /// \brief  Replace the contents of the stack with a stack read from a
+    ///         stream written by serialize.
+    ///
+    /// \param reader   The source, such as a \c std::istream opened in binary
+    ///                 mode.
+    ///
+    /// \return \c true if a complete stack was read, \c false otherwise. On
+    ///         failure the stack holds the items read before the error, which
+    ///         are the topmost items of the serialized stack.
+    ///
+    /// \remark Type \c T must be trivially copyable. Other types can be
+    ///         read with the overload that takes a decoder.
+    template<typename Reader>
+    bool deserialize(Reader &reader)
+    {
+        node   *tail{nullptr};
+
+        clear();
+        return list_stream::read<T>(reader, [&](const T &value) { tail = append_bottom(tail, value); });
+    }
+
+    /// \brief  Replace the contents of the stack with a stack read from a
+    ///         stream, decoding each item with a caller-supplied function.
+    ///
+    /// \param reader   The source of the serialized stack.
+    /// \param decode   Function called as \c decode(reader, item) to read each
+    ///                 item into a default-constructed \c T, returning
+    ///                 \c false on failure.
+    ///
+    /// \return \c true if a complete stack was read, \c false otherwise.
+    template<typename Reader, typename Decoder>
+    bool deserialize(Reader &reader, Decoder decode)
+    {
+        node   *tail{nullptr};
+
+        clear();
+        return list_stream::read<T>(reader, decode, [&](const T &value) { tail = append_bottom(tail, value); });
+    }
+
 private:
     // This is our linked list node
     struct node
@@ -106,12 +387,101 @@ private:
             _next{nullptr}
         {}
 
+        // Accessors used by the list_stream serialization helpers
+        const T &data() const noexcept
+        {
+            return _data;
+        }
+
+        const node *next() const noexcept
+        {
+            return _next;
+        }
+
         T     _data;    // The pushed data
         node *_next;    // Pointer to the next node in the linked list
     };
 
+    using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<node>;
+    using node_traits = std::allocator_traits<node_allocator>;
+
+    // Obtain a node from the allocator and construct it with the given data.
+    node *create_node(const T &value)
+    {
+        node *new_node = node_traits::allocate(_allocator, 1);
+
+        try
+        {
+            node_traits::construct(_allocator, new_node, value);
+        }
+        catch (...)
+        {
+            node_traits::deallocate(_allocator, new_node, 1);
+            throw;
+        }
+
+        return new_node;
+    }
+
+    // Destroy a node and return its memory to the allocator.
+    void destroy_node(node *old_node)
+    {
+        node_traits::destroy(_allocator, old_node);
+        node_traits::deallocate(_allocator, old_node, 1);
+    }
+
+    // Delete all of the data nodes in the linked list.
+    void clear()
+    {
+        while (_head)
+        {
+            node *new_head = _head->_next;
+            destroy_node(_head);
+            DS_STACK_STATS(_stats.record_deallocation();)
+            _head = new_head;
+        }
+        _size = 0;
+    }
+
+    // Add an item below the current bottom of the stack, which is the node
+    // tail, and return the new bottom node. Used to rebuild a stack from the
+    // top down.
+    node *append_bottom(node *tail, const T &value)
+    {
+        node *new_node = create_node(value);
+        DS_STACK_STATS(_stats.record_allocation(sizeof(node));)
+
+        if (tail)
+            tail->_next = new_node;
+        else
+            _head = new_node;
+
+        ++_size;
+        DS_STACK_STATS(_stats.record_size(_size);)
+
+        return new_node;
+    }
+
     size_t  _size;  // The current number of items in the stack.
     node   *_head;  // The current head of the list, which is also the top of the stack.
+    node_allocator  _allocator; // Allocator from which nodes are obtained
+#if defined(DS_ENABLE_STATS)
+    StackStats  _stats; // Instrumentation counters
+#endif
 };
 
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  A Stack whose nodes are obtained from a \c std::pmr::memory_resource.
+///
+/// Stacks drawing from a monotonic resource and from a pool resource have
+/// the same type, so they can be passed to the same non-template functions.
+template<typename T>
+using Stack = ::Stack<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
 #endif  // INC_STACK
@@ -0,0 +1,75 @@
+/// \file   StackStats.h
+/// \brief  Optional instrumentation counters for the C++ stack.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2022--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_STACK_STATS
+#define INC_STACK_STATS
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/// \brief  Statements passed to this macro are compiled only when the
+///         instrumentation counters are enabled by defining DS_ENABLE_STATS.
+///
+/// When DS_ENABLE_STATS is not defined the counters are never updated and
+/// the stack carries no additional data, so the instrumentation costs nothing.
+#if defined(DS_ENABLE_STATS)
+#  define DS_STACK_STATS(...)   __VA_ARGS__
+#else
+#  define DS_STACK_STATS(...)
+#endif
+
+/// \brief  Counters describing the activity of a stack.
+///
+/// A stack keeps these counters only when DS_ENABLE_STATS is defined;
+/// otherwise its \c stats member function reports all zeros.
+struct StackStats
+{
+    std::uint64_t   allocations{0};     ///< Number of nodes allocated
+    std::uint64_t   deallocations{0};   ///< Number of nodes freed
+    std::uint64_t   bytes_allocated{0}; ///< Total bytes allocated for nodes
+    std::uint64_t   peak_size{0};       ///< Largest number of items held
+
+    /// \brief  Record the allocation of nodes of the given size.
+    void record_allocation(std::size_t bytes, std::uint64_t count = 1) noexcept
+    {
+        allocations += count;
+        bytes_allocated += bytes * count;
+    }
+
+    /// \brief  Record the freeing of nodes.
+    void record_deallocation(std::uint64_t count = 1) noexcept
+    {
+        deallocations += count;
+    }
+
+    /// \brief  Record the current number of items.
+    void record_size(std::uint64_t size) noexcept
+    {
+        if (size > peak_size)
+            peak_size = size;
+    }
+
+    /// \brief  Write the counters as human-readable text, one per line.
+    void write_text(std::ostream &out) const
+    {
+        out << "allocations:      " << allocations << '\n'
+            << "deallocations:    " << deallocations << '\n'
+            << "bytes allocated:  " << bytes_allocated << '\n'
+            << "peak size:        " << peak_size << '\n';
+    }
+
+    /// \brief  Write the counters as a JSON object.
+    void write_json(std::ostream &out) const
+    {
+        out << "{\"allocations\":" << allocations
+            << ",\"deallocations\":" << deallocations
+            << ",\"bytes_allocated\":" << bytes_allocated
+            << ",\"peak_size\":" << peak_size
+            << '}';
+    }
+};
+
+#endif  // INC_STACK_STATS
@@ -1,19 +1,26 @@
 #include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "../Stack.h"
+#include "../SmallStack.h"
 
 namespace {
 
 // Helper function to display the size of the stack
-inline void print_stack_size(Stack<int> &stack)
+template<typename StackType>
+inline void print_stack_size(StackType &stack)
 {
     std::cout << "Stack size is " << stack.size() << '\n';
 }
 
 // Helper function to display the value on the top of the stack,
 // or a message if the stack is empty.
-void print_stack_top(Stack<int> &stack)
+template<typename StackType>
+void print_stack_top(StackType &stack)
 {
     if (stack.is_empty())
         std::cout << "The stack is empty.\n";
@@ -35,8 +42,9 @@ void evaluate_postfix(const char *expression, int expected_result)
 {
     std::cout << "Evaluating postfix expression \"" << expression << '\n';
 
-    // create a new stack
-    Stack<int> stack;
+    // create a new stack. Expressions rarely need more than a few items on
+    // the stack, so a SmallStack evaluates them without allocating memory.
+    SmallStack<int, 16> stack;
 
     while (*expression)
     {
@@ -105,6 +113,209 @@ void evaluate_postfix(const char *expression, int expected_result)
     }
 }
 
+// Write a stack to a stream and read it back.
+void demonstrate_serialization()
+{
+    std::cout << "Serializing a stack of integers\n";
+
+    Stack<int>          stack;
+    std::stringstream   stream(std::ios::in | std::ios::out | std::ios::binary);
+
+    for (int i = 0; i < 10000; ++i)
+        stack.push(i);
+
+    Stack<int>  copy;
+    if (stack.serialize(stream) && copy.deserialize(stream))
+        std::cout << "Read back " << copy.size() << " items, top is " << copy.top() << '\n';
+    else
+        std::cout << "Serialization failed!\n";
+
+    // Types that are not trivially copyable are written with an encoder
+    // and read with a decoder.
+    std::cout << "Serializing a stack of strings\n";
+
+    Stack<std::string>  words;
+    std::stringstream   word_stream(std::ios::in | std::ios::out | std::ios::binary);
+
+    words.push("bottom");
+    words.push("middle");
+    words.push("top");
+
+    auto encode = [](std::ostream &out, const std::string &word)
+    {
+        std::uint32_t length = static_cast<std::uint32_t>(word.size());
+
+        out.write(reinterpret_cast<const char *>(&length), sizeof(length));
+        out.write(word.data(), length);
+        return static_cast<bool>(out);
+    };
+    auto decode = [](std::istream &in, std::string &word)
+    {
+        std::uint32_t length;
+
+        if (!in.read(reinterpret_cast<char *>(&length), sizeof(length)))
+            return false;
+        word.resize(length);
+        return static_cast<bool>(in.read(&word[0], length));
+    };
+
+    Stack<std::string>  word_copy;
+    if (words.serialize(word_stream, encode) && word_copy.deserialize(word_stream, decode))
+    {
+        while (!word_copy.is_empty())
+        {
+            std::cout << "Popped \"" << word_copy.top() << "\"\n";
+            word_copy.pop();
+        }
+    }
+    else
+    {
+        std::cout << "Serialization failed!\n";
+    }
+}
+
+// Push copies of the top item of a SmallStack of strings past its inline
+// capacity, so that one push moves the items while copying one of them.
+void demonstrate_push_top()
+{
+    SmallStack<std::string, 2>  stack;
+    bool                        correct{true};
+
+    stack.push("a long string that does not fit in the small-string buffer");
+    for (int i = 0; i < 9; ++i)
+    {
+        stack.push(stack.top());
+        correct = correct && stack.top() == "a long string that does not fit in the small-string buffer";
+    }
+
+    std::cout << "Pushed the top of a SmallStack " << stack.size() - 1 << " times, "
+              << (correct ? "every copy intact\n" : "but a copy was wrong!\n");
+}
+
+// Compare Stack and SmallStack when many short-lived stacks are used, as in
+// expression evaluation or depth-first searches of small graphs.
+void benchmark_small_stack()
+{
+    constexpr int   iterations = 1000000;
+    constexpr int   depth = 24;
+    long long       sum = 0;
+
+    std::cout << "Using " << iterations << " short-lived stacks of " << depth << " items\n";
+
+    auto then = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        Stack<int>  stack;
+
+        for (int j = 0; j < depth; ++j)
+            stack.push(i + j);
+        while (!stack.is_empty())
+        {
+            sum += stack.top();
+            stack.pop();
+        }
+    }
+    auto now = std::chrono::high_resolution_clock::now();
+    std::cout << "Stack took about "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+              << " milliseconds\n";
+
+    then = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        SmallStack<int, 32> stack;
+
+        for (int j = 0; j < depth; ++j)
+            stack.push(i + j);
+        while (!stack.is_empty())
+        {
+            sum -= stack.top();
+            stack.pop();
+        }
+    }
+    now = std::chrono::high_resolution_clock::now();
+    std::cout << "SmallStack took about "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+              << " milliseconds\n";
+
+    if (sum != 0)
+        std::cout << "The stacks did not produce the same results!\n";
+
+    // A SmallStack that outgrows its inline storage moves its items to the heap.
+    SmallStack<int, 4>  small;
+    for (int i = 0; i < 100; ++i)
+        small.push(i);
+    std::cout << "A SmallStack<int, 4> holding " << small.size() << " items "
+              << (small.is_inline() ? "is still inline" : "has moved to the heap")
+              << ", capacity " << small.capacity() << '\n';
+}
+
+// Compare pushing and popping items one at a time with the batch operations,
+// as a parser might do with a buffer of tokens.
+void benchmark_batch_operations()
+{
+    constexpr int       count = 10000000;
+    std::vector<int>    tokens;
+    long long           sum = 0;
+
+    tokens.reserve(count);
+    for (int i = 0; i < count; ++i)
+        tokens.push_back(i);
+
+    std::cout << "Moving " << count << " tokens through a stack\n";
+
+    {
+        Stack<int>  stack;
+
+        auto then = std::chrono::high_resolution_clock::now();
+        for (int token : tokens)
+            stack.push(token);
+        auto now = std::chrono::high_resolution_clock::now();
+        std::cout << "pushing one at a time took about "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+                  << " milliseconds\n";
+
+        then = std::chrono::high_resolution_clock::now();
+        while (!stack.is_empty())
+        {
+            sum += stack.top();
+            stack.pop();
+        }
+        now = std::chrono::high_resolution_clock::now();
+        std::cout << "top and pop one at a time took about "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+                  << " milliseconds\n";
+    }
+
+    {
+        auto then = std::chrono::high_resolution_clock::now();
+        Stack<int>  stack(tokens.begin(), tokens.end());
+        auto now = std::chrono::high_resolution_clock::now();
+        std::cout << "constructing from the range took about "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+                  << " milliseconds\n";
+
+        then = std::chrono::high_resolution_clock::now();
+        stack.drain([&sum](int token) { sum -= token; });
+        now = std::chrono::high_resolution_clock::now();
+        std::cout << "draining took about "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
+                  << " milliseconds\n";
+    }
+
+    if (sum != 0)
+        std::cout << "The batch operations did not see the same tokens!\n";
+
+    // Items can be popped in batches into a buffer.
+    Stack<int>          stack;
+    std::vector<int>    popped;
+
+    stack.push_range(tokens.begin(), tokens.begin() + 10);
+    stack.pop_n(4, std::back_inserter(popped));
+    std::cout << "After popping " << popped.size() << " items, starting with "
+              << popped.front() << ", the top of the stack is " << stack.top() << '\n';
+}
+
 } // end of anonymous namespace
 
 int main()
@@ -167,6 +378,11 @@ int main()
                 << std::chrono::duration_cast<std::chrono::milliseconds>(now - then).count()
                 << " milliseconds\n";
 
+        std::cout << "counters for the 10,000,000 element stack:\n";
+        stack2.stats().write_text(std::cout);
+        stack2.stats().write_json(std::cout);
+        std::cout << '\n';
+
         dthen = std::chrono::high_resolution_clock::now();
         std::cout << "destroying a stack with 10,000,000 elements\n";
     }
@@ -175,6 +391,14 @@ int main()
               << std::chrono::duration_cast<std::chrono::milliseconds>(dnow - dthen).count()
               << " milliseconds\n";
 
+    demonstrate_serialization();
+
+    demonstrate_push_top();
+
+    benchmark_small_stack();
+
+    benchmark_batch_operations();
+
     // evaluate a postfix expresion.
     evaluate_postfix("9 2 8 * + 3 - 2 /", 11);
 }
@@ -10,7 +10,7 @@
 // Helper function to display the size of the stack
 void print_stack_size(stack *stack)
 {
-    printf("Stack size is %d\n", stack_size(stack));
+    printf("Stack size is %zu\n", stack_size(stack));
 }
 
 // Helper function to display the value on the top of the stack,
@@ -101,13 +101,41 @@ void evaluate_postfix(const char *expression, int expected_result)
     }
     else
     {
-        printf("Oops! Stack should have 1 item in it, but has %d instead!\n", stack_size(stack));
+        printf("Oops! Stack should have 1 item in it, but has %zu instead!\n", stack_size(stack));
     }
 
     // delete the stack.
     stack_delete(stack);
 }
 
+// Write a stack to a temporary file and read it back.
+void demonstrate_serialization(void)
+{
+    stack *original = stack_create(100);
+    stack *copy = stack_create(100);
+    FILE *file = tmpfile();
+
+    printf("Serializing a stack\n");
+
+    for (int i = 0; i < 100; i++)
+        stack_push(original, i);
+
+    if (file != NULL && original != NULL && copy != NULL
+        && stack_serialize(original, file)
+        && fseek(file, 0, SEEK_SET) == 0
+        && stack_deserialize(copy, file))
+        printf("Read back %zu items, top is %d\n", stack_size(copy), stack_top(copy));
+    else
+        printf("Serialization failed!\n");
+
+    if (file != NULL)
+        fclose(file);
+    if (copy != NULL)
+        stack_delete(copy);
+    if (original != NULL)
+        stack_delete(original);
+}
+
 int main(void)
 {
     // create a new stack that can hold up to 10 integers
@@ -177,6 +205,14 @@ int main(void)
     printf("pushing took about %ld seconds\n", now - then);
 #endif
 
+    stack_stats stats;
+
+    stack_get_stats(stack, &stats);
+    printf("counters for the 10,000,000 element stack:\n");
+    stack_stats_print_text(stdout, &stats);
+    stack_stats_print_json(stdout, &stats);
+    printf("\n");
+
     printf("deleting a stack with 10,000,000 elements\n");
     then = time(NULL);
     stack_delete(stack);
@@ -187,6 +223,8 @@ int main(void)
     printf("deleting took about %ld seconds\n", now - then);
 #endif
 
+    demonstrate_serialization();
+
     // evaluate a postfix expresion.
     evaluate_postfix("9 2 8 * + 3 - 2 /", 11);
 }
\ No newline at end of file
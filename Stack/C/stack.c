@@ -4,10 +4,16 @@
 /// \copyright  Copyright (c) 2022--2024 Jeffrey K. Bienstadt
 
 #include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>     // for malloc/free
 
 #include "stack.h"
 
+// Number of items copied through the buffer used by stack_serialize.
+#define STACK_STREAM_CHUNK  1024
+
 /// \brief  Create a new stack with the specified capacity
 ///
 /// \param capacity The maximum size of this stack.
@@ -28,6 +34,14 @@ stack *stack_create(size_t capacity)
         return NULL;
     }
 
+    stack_stats empty = {0};
+
+    new_stack->stats = empty;
+    DS_STACK_STATS(
+        new_stack->stats.allocations = 2;
+        new_stack->stats.bytes_allocated = sizeof(stack) + capacity * sizeof(int);
+    )
+
     return new_stack;
 }
 
@@ -49,6 +63,11 @@ void stack_push(stack *stack, int value)
     assert(!stack_is_full(stack));
 
     stack->data[stack->top++] = value;
+    DS_STACK_STATS(
+        ++stack->stats.pushes;
+        if (stack->top > stack->stats.peak_size)
+            stack->stats.peak_size = stack->top;
+    )
 }
 
 /// \brief  Pop an item off of the top of the stack.
@@ -59,6 +78,7 @@ void stack_pop(stack *stack)
     assert(!stack_is_empty(stack));
 
     --stack->top;
+    DS_STACK_STATS(++stack->stats.pops;)
 }
 
 /// \brief  Return the top item on the stack.
@@ -112,3 +132,174 @@ int stack_is_full(const stack *stack)
 {
     return stack->top == stack->capacity;
 }
+
+/// \brief  Write a stack to a stream in a binary format.
+///
+/// \param stack    Pointer to the stack.
+/// \param out      The stream to which the stack is written, opened in
+///                 binary mode.
+///
+/// \return Non-zero on success, zero if the stack could not be written.
+///
+/// The items are written from the top of the stack to the bottom, preceded
+/// by a header giving the size of each item and the number of items, in
+/// length-prefixed chunks:
+///
+///     uint32  size of each item
+///     uint64  number of items
+///     repeated until all items have been written:
+///         uint32  number of items in this chunk
+///         the items of the chunk
+///
+/// Integers are stored in the native byte order of the machine. This is the
+/// same format written by the C++ Stack<int>.
+int stack_serialize(const stack *stack, FILE *out)
+{
+    int buffer[STACK_STREAM_CHUNK];
+    uint32_t item_size = (uint32_t)sizeof(int);
+    uint64_t count = stack->top;
+    size_t position = stack->top;
+
+    if (fwrite(&item_size, sizeof(item_size), 1, out) != 1
+        || fwrite(&count, sizeof(count), 1, out) != 1)
+        return 0;
+
+    // The items are stored bottom first, so each chunk is copied into the
+    // buffer in reverse.
+    while (position > 0)
+    {
+        uint32_t used = 0;
+
+        for (; used < STACK_STREAM_CHUNK && position > 0; ++used)
+            buffer[used] = stack->data[--position];
+
+        if (fwrite(&used, sizeof(used), 1, out) != 1
+            || fwrite(buffer, sizeof(int), used, out) != used)
+            return 0;
+    }
+
+    return 1;
+}
+
+/// \brief  Replace the contents of a stack with a stack read from a stream
+///         written by stack_serialize.
+///
+/// \param stack    Pointer to the stack.
+/// \param in       The stream from which the stack is read, opened in binary
+///                 mode.
+///
+/// \return Non-zero on success, zero if a complete stack could not be read
+///         or the stack's capacity is too small to hold it. On failure the
+///         stack is empty.
+int stack_deserialize(stack *stack, FILE *in)
+{
+    uint32_t item_size;
+    uint64_t count;
+    size_t position;
+
+    stack->top = 0;
+
+    if (fread(&item_size, sizeof(item_size), 1, in) != 1
+        || item_size != sizeof(int)
+        || fread(&count, sizeof(count), 1, in) != 1
+        || count > stack->capacity)
+        return 0;
+
+    // The items arrive top first. Each chunk is read directly into the
+    // stack's storage at its final position, and then put in bottom-first
+    // order.
+    position = (size_t)count;
+    while (position > 0)
+    {
+        uint32_t length;
+        int *first;
+
+        if (fread(&length, sizeof(length), 1, in) != 1 || length == 0 || length > position)
+            return 0;
+
+        position -= length;
+        first = stack->data + position;
+        if (fread(first, sizeof(int), length, in) != length)
+            return 0;
+
+        for (int *last = first + length - 1; first < last; ++first, --last)
+        {
+            int item = *first;
+            *first = *last;
+            *last = item;
+        }
+    }
+
+    stack->top = (size_t)count;
+    DS_STACK_STATS(
+        stack->stats.pushes += count;
+        if (stack->top > stack->stats.peak_size)
+            stack->stats.peak_size = stack->top;
+    )
+
+    return 1;
+}
+
+/// \brief  Retrieve the counters describing the activity of a stack.
+///
+/// \param stack    Pointer to the stack.
+/// \param stats    Pointer to the structure that receives the counters.
+///
+/// \remark The counters are updated only when the library is built with
+///         DS_ENABLE_STATS defined; otherwise they are all zero.
+void stack_get_stats(const stack *stack, stack_stats *stats)
+{
+    stack_stats empty = {0};
+
+    (void)stack;
+    *stats = empty;
+    DS_STACK_STATS(*stats = stack->stats;)
+}
+
+/// \brief  Reset the counters describing the activity of a stack.
+///
+/// The allocation counters describe the stack's storage and are kept; the
+/// remaining counters are set to zero, and the peak size to the current size.
+///
+/// \param stack    Pointer to the stack.
+void stack_reset_stats(stack *stack)
+{
+    (void)stack;
+    DS_STACK_STATS(
+        stack->stats.pushes = 0;
+        stack->stats.pops = 0;
+        stack->stats.peak_size = stack->top;
+    )
+}
+
+/// \brief  Write stack counters as human-readable text, one per line.
+///
+/// \param out      The stream to which the counters are written.
+/// \param stats    Pointer to the counters.
+void stack_stats_print_text(FILE *out, const stack_stats *stats)
+{
+    fprintf(out,
+            "allocations:      %" PRIu64 "\n"
+            "bytes allocated:  %" PRIu64 "\n"
+            "pushes:           %" PRIu64 "\n"
+            "pops:             %" PRIu64 "\n"
+            "peak size:        %" PRIu64 "\n",
+            stats->allocations, stats->bytes_allocated, stats->pushes,
+            stats->pops, stats->peak_size);
+}
+
+/// \brief  Write stack counters as a JSON object.
+///
+/// \param out      The stream to which the counters are written.
+/// \param stats    Pointer to the counters.
+void stack_stats_print_json(FILE *out, const stack_stats *stats)
+{
+    fprintf(out,
+            "{\"allocations\":%" PRIu64
+            ",\"bytes_allocated\":%" PRIu64
+            ",\"pushes\":%" PRIu64
+            ",\"pops\":%" PRIu64
+            ",\"peak_size\":%" PRIu64 "}",
+            stats->allocations, stats->bytes_allocated, stats->pushes,
+            stats->pops, stats->peak_size);
+}
@@ -6,12 +6,40 @@
 #ifndef INC_STACK
 #define INC_STACK
 
+#include <stddef.h>
+#include <stdio.h>
+
+#include <stdint.h>
+
+/// \brief  Statements passed to this macro are compiled only when the
+///         instrumentation counters are enabled by defining DS_ENABLE_STATS.
+#if defined(DS_ENABLE_STATS)
+#  define DS_STACK_STATS(...)   __VA_ARGS__
+#else
+#  define DS_STACK_STATS(...)
+#endif
+
+/// \brief  Counters describing the activity of a stack.
+///
+/// Every stack holds these counters, so that the structure has the same
+/// layout whether or not DS_ENABLE_STATS is defined, but they are updated
+/// only when it is; otherwise stack_get_stats reports all zeros.
+typedef struct stack_stats
+{
+    uint64_t allocations;       ///< Number of memory blocks allocated
+    uint64_t bytes_allocated;   ///< Total bytes allocated
+    uint64_t pushes;            ///< Number of items pushed
+    uint64_t pops;              ///< Number of items popped
+    uint64_t peak_size;         ///< Largest number of items held
+} stack_stats;
+
 /// \brief  A simple stack of integers.
 typedef struct stack
 {
     size_t  capacity;   ///< stack capacity
     size_t  top;        ///< current position of the top of the stack
     int    *data;       ///< contents of the stack
+    stack_stats stats;  ///< instrumentation counters
 } stack;
 
 stack *stack_create(size_t capacity);
@@ -23,5 +51,11 @@ size_t stack_size(const stack *stack);
 size_t stack_capacity(const stack *stack);
 int stack_is_empty(const stack *stack);
 int stack_is_full(const stack *stack);
+int stack_serialize(const stack *stack, FILE *out);
+int stack_deserialize(stack *stack, FILE *in);
+void stack_get_stats(const stack *stack, stack_stats *stats);
+void stack_reset_stats(stack *stack);
+void stack_stats_print_text(FILE *out, const stack_stats *stats);
+void stack_stats_print_json(FILE *out, const stack_stats *stats);
 
 #endif  // INC_STACK
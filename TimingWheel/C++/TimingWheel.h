@@ -0,0 +1,321 @@
+/// \file   TimingWheel.h
+/// \brief  Implementation of a hierarchical timing wheel in C++.
+/// \author Jeffrey K. Bienstadt
+/// \copyright  Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#ifndef INC_TIMING_WHEEL
+#define INC_TIMING_WHEEL
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#  include <memory_resource>
+#endif
+#include <utility>
+
+#include "../../LinkedList/C++/DoubleLinkedList.h"
+
+/// \brief  A set of timers, each holding an item that is handed back when
+///         the timer expires, advanced one tick at a time.
+///
+/// The wheel has four levels of 256 slots, and each slot is a
+/// DoubleLinkedList of the timers due in it. A level-0 slot holds the
+/// timers due on one tick within the next 256; a level-1 slot those due in
+/// one span of 256 ticks within the next 65536, and so on. Scheduling a
+/// timer appends it to the slot for its expiry, and cancelling it removes
+/// its node, both in constant time. When the wheel moves onto a new span
+/// of a level, the timers in that span's slot are spread over the level
+/// below, relinking their nodes without copying them, and on every tick
+/// the timers in the current level-0 slot expire together.
+///
+/// Timers further ahead than the four levels reach, 2^32 ticks, are kept in
+/// the top level and spread out again until they come within reach.
+///
+/// \tparam T           The type of the items held by the timers.
+/// \tparam Allocator   The allocator from which the timers' nodes and the
+///                     slots are obtained. It is rebound to the types
+///                     required.
+template<typename T, typename Allocator = std::allocator<T>>
+class TimingWheel
+{
+public:
+    /// \brief  The data held in a timer's node.
+    class entry_t
+    {
+    private:
+        T               _item;          ///< The item handed back on expiry
+        std::uint64_t   _expiry;        ///< The tick on which the timer expires
+        std::uint32_t   _slot{0};       ///< The slot holding the timer
+
+    public:
+        entry_t(const T &item, std::uint64_t expiry)
+          : _item{item},
+            _expiry{expiry}
+        {}
+
+        /// \brief  Return a reference to the timer's item.
+        const T &item() const noexcept
+        {
+            return _item;
+        }
+
+        /// \brief  Return the tick on which the timer expires.
+        std::uint64_t expiry() const noexcept
+        {
+            return _expiry;
+        }
+
+        friend TimingWheel;
+    };
+
+private:
+    using entry_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<entry_t>;
+    using list_type = DoubleLinkedList<entry_t, entry_allocator>;
+
+public:
+    /// \brief  The type of a timer, a pointer to which is returned by
+    ///         \c schedule and passed to \c cancel and \c reschedule.
+    using timer_t = typename list_type::node_t;
+
+    /// \brief  The type of the allocator used by the wheel.
+    using allocator_type = Allocator;
+
+    /// \brief  The number of levels in the wheel.
+    static constexpr unsigned       level_count{4};
+
+    /// \brief  The number of bits of a tick number that select a slot in
+    ///         one level.
+    static constexpr unsigned       slot_bits{8};
+
+    /// \brief  The number of slots in each level.
+    static constexpr std::uint32_t  level_slots{1u << slot_bits};
+
+    /// \brief  Default-construct an empty TimingWheel at tick zero.
+    TimingWheel()
+      : TimingWheel(Allocator())
+    {
+    }
+
+    /// \brief  Construct an empty TimingWheel at tick zero, whose timers
+    ///         and slots are obtained from the given allocator.
+    explicit TimingWheel(const Allocator &allocator)
+      : _slot_allocator(allocator)
+    {
+        // The slots are constructed directly rather than through the
+        // allocator, which for a polymorphic_allocator would try to pass
+        // itself to each list as a second, unwanted argument.
+        _slots = slot_traits::allocate(_slot_allocator, slot_count);
+        for (std::uint32_t s = 0; s < slot_count; ++s)
+            ::new (static_cast<void *>(_slots + s)) list_type(entry_allocator(allocator));
+    }
+
+    TimingWheel(const TimingWheel &) = delete;
+    TimingWheel & operator=(const TimingWheel &) = delete;
+
+    /// \brief  Destroy a TimingWheel, discarding any pending timers.
+    ~TimingWheel()
+    {
+        for (std::uint32_t s = 0; s < slot_count; ++s)
+            _slots[s].~list_type();
+        slot_traits::deallocate(_slot_allocator, _slots, slot_count);
+    }
+
+    /// \brief  Return the current tick.
+    std::uint64_t now() const noexcept
+    {
+        return _now;
+    }
+
+    /// \brief  Return the number of pending timers.
+    size_t size() const noexcept
+    {
+        return _count;
+    }
+
+    /// \brief  Determine if the wheel has no pending timers.
+    ///
+    /// \return \c true if no timers are pending, \c false otherwise.
+    bool is_empty() const noexcept
+    {
+        return _count == 0;
+    }
+
+    /// \brief  Start a timer.
+    ///
+    /// \param delay    The number of ticks after which the timer expires. A
+    ///                 delay of zero is taken as one, since the current
+    ///                 tick's timers have already expired.
+    /// \param item     The item to be handed back when the timer expires.
+    ///
+    /// \return A pointer to the timer, which remains valid until the timer
+    ///         expires or is cancelled.
+    timer_t *schedule(std::uint64_t delay, const T &item)
+    {
+        entry_t         entry{item, _now + (delay == 0 ? 1 : delay)};
+        std::uint32_t   slot{slot_for(entry._expiry)};
+        timer_t        *timer{_slots[slot].append(entry)};
+
+        timer->data()._slot = slot;
+        ++_count;
+
+        return timer;
+    }
+
+    /// \brief  Stop a pending timer without its expiring.
+    ///
+    /// \param timer    The timer, as returned by \c schedule.
+    void cancel(timer_t *timer)
+    {
+        _slots[timer->data()._slot].remove(timer);
+        --_count;
+    }
+
+    /// \brief  Change the expiry of a pending timer.
+    ///
+    /// \param timer    The timer, as returned by \c schedule.
+    /// \param delay    The number of ticks from now after which the timer
+    ///                 expires. A delay of zero is taken as one.
+    ///
+    /// The timer's node is moved to its new slot without being copied, so
+    /// the pointer to the timer remains valid.
+    void reschedule(timer_t *timer, std::uint64_t delay)
+    {
+        timer->data()._expiry = _now + (delay == 0 ? 1 : delay);
+        move(timer);
+    }
+
+    /// \brief  Advance the wheel, expiring the timers that fall due.
+    ///
+    /// \param ticks    The number of ticks by which to advance.
+    /// \param expire   Function called with a reference to the item of each
+    ///                 expired timer, after the timer has been removed from
+    ///                 the wheel. It may schedule and cancel other timers.
+    ///
+    /// \return The number of timers that expired.
+    ///
+    /// The timers due on one tick expire together, in the order in which
+    /// they reached their level-0 slot.
+    template<typename Visitor>
+    size_t advance(std::uint64_t ticks, Visitor expire)
+    {
+        size_t  expired{0};
+
+        while (ticks-- > 0)
+        {
+            // With nothing pending, the remaining ticks have nothing to do.
+            if (_count == 0)
+            {
+                _now += ticks + 1;
+                break;
+            }
+
+            ++_now;
+            for (unsigned level = 1; level < level_count && low_bits_zero(level); ++level)
+                cascade(level);
+
+            list_type  &due{_slots[_now & (level_slots - 1)]};
+
+            while (!due.is_empty())
+            {
+                timer_t    *timer{due.head()};
+                T           item{std::move(timer->data()._item)};
+
+                due.remove(timer);
+                --_count;
+                ++expired;
+                expire(item);
+            }
+        }
+
+        return expired;
+    }
+
+    /// \brief  Cancel every pending timer.
+    void clear()
+    {
+        for (std::uint32_t s = 0; s < slot_count; ++s)
+            _slots[s].erase();
+        _count = 0;
+    }
+
+    /// \brief  Return a copy of the wheel's allocator.
+    allocator_type get_allocator() const
+    {
+        return allocator_type(_slot_allocator);
+    }
+
+private:
+    using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<list_type>;
+    using slot_traits = std::allocator_traits<slot_allocator>;
+
+    static constexpr std::uint32_t  slot_count{level_count * level_slots};
+    static constexpr std::uint64_t  span{std::uint64_t{1} << (slot_bits * level_count)};
+
+    // Determine whether the current tick starts a new span of a level.
+    bool low_bits_zero(unsigned level) const noexcept
+    {
+        return (_now & ((std::uint64_t{1} << (slot_bits * level)) - 1)) == 0;
+    }
+
+    // Return the slot for a timer expiring on the given tick, which is
+    // after the current tick or equal to it. The level is chosen by how far
+    // ahead the expiry is, and the slot within the level by the expiry's
+    // bits for that level.
+    std::uint32_t slot_for(std::uint64_t expiry) const noexcept
+    {
+        std::uint64_t   delay{expiry - _now};
+        unsigned        level{0};
+
+        if (delay >= span)
+            expiry = _now + span - 1;
+
+        while (level + 1 < level_count && (delay >> (slot_bits * (level + 1))) != 0)
+            ++level;
+
+        return level * level_slots
+             + std::uint32_t((expiry >> (slot_bits * level)) & (level_slots - 1));
+    }
+
+    // Move a timer to the slot for its expiry.
+    void move(timer_t *timer)
+    {
+        std::uint32_t   slot{slot_for(timer->data()._expiry)};
+
+        _slots[slot].splice(nullptr, _slots[timer->data()._slot], timer);
+        timer->data()._slot = slot;
+    }
+
+    // Spread the timers in the current slot of a level over the levels
+    // below it, or, for timers still out of reach, another slot of the top
+    // level.
+    void cascade(unsigned level)
+    {
+        const std::uint32_t slot{level * level_slots
+                                 + std::uint32_t((_now >> (slot_bits * level)) & (level_slots - 1))};
+
+        while (!_slots[slot].is_empty())
+            move(_slots[slot].head());
+    }
+
+    // Instance data
+    list_type      *_slots{nullptr};    ///< The slots of every level, level 0 first
+    std::uint64_t   _now{0};            ///< The current tick
+    size_t          _count{0};          ///< Number of pending timers
+    slot_allocator  _slot_allocator;    ///< Allocator from which the slots are obtained
+};
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+namespace pmr
+{
+
+/// \brief  A TimingWheel whose timers are obtained from a
+///         \c std::pmr::memory_resource.
+template<typename T>
+using TimingWheel = ::TimingWheel<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+#endif
+
+#endif  // INC_TIMING_WHEEL
@@ -0,0 +1,183 @@
+// Copyright (c) 2019--2026 Jeffrey K. Bienstadt
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../TimingWheel.h"
+#include "../../../PriorityQueue/C++/PairingHeap.h"
+
+namespace {
+
+constexpr size_t        timer_count = 1000000;
+constexpr std::uint64_t max_delay = 1 << 16;
+
+using clock_type = std::chrono::high_resolution_clock;
+
+long long elapsed_ms(clock_type::time_point then)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(clock_type::now() - then).count();
+}
+
+// Schedule, cancel and reschedule timers at random, some far enough ahead
+// to start in the top level, and check that every timer expires exactly on
+// its tick and that cancelled timers never do.
+bool check_expiry()
+{
+    using wheel_type = TimingWheel<size_t>;
+
+    wheel_type                          wheel;
+    std::vector<wheel_type::timer_t *>  timers;
+    std::vector<std::uint64_t>          due;        // expiry tick, or zero once finished
+    std::mt19937_64                     engine{2019};
+    bool                                correct{true};
+    size_t                              pending{0};
+
+    auto    expire = [&](size_t id)
+    {
+        correct = correct && due[id] == wheel.now();
+        due[id] = 0;
+        --pending;
+    };
+
+    for (int round = 0; round < 2000; ++round)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            // Mostly short delays, with a few reaching each level.
+            unsigned        shift{unsigned(engine() % 26)};
+            std::uint64_t   delay{engine() % (std::uint64_t{1} << shift)};
+            size_t          id{due.size()};
+
+            timers.push_back(wheel.schedule(delay, id));
+            due.push_back(wheel.now() + (delay == 0 ? 1 : delay));
+            ++pending;
+        }
+
+        for (int i = 0; i < 5; ++i)
+        {
+            size_t  id{size_t(engine() % due.size())};
+
+            if (due[id] == 0)
+                continue;
+
+            if (engine() % 2)
+            {
+                wheel.cancel(timers[id]);
+                due[id] = 0;
+                --pending;
+            }
+            else
+            {
+                std::uint64_t   delay{engine() % (std::uint64_t{1} << (engine() % 20))};
+
+                wheel.reschedule(timers[id], delay);
+                due[id] = wheel.now() + (delay == 0 ? 1 : delay);
+                correct = correct && timers[id]->data().expiry() == due[id];
+            }
+        }
+
+        wheel.advance(engine() % 64, expire);
+        correct = correct && wheel.size() == pending;
+    }
+
+    wheel.advance(std::uint64_t{1} << 26, expire);
+
+    return correct && pending == 0 && wheel.is_empty();
+}
+
+// The same work with timers kept in a PairingHeap ordered by expiry, each
+// cancelled by erasing its node.
+using heap_entry = std::pair<std::uint64_t, size_t>;    // expiry, id
+using heap_type = PairingHeap<heap_entry, std::greater<heap_entry>>;
+
+} // namespace
+
+int main()
+{
+    std::cout << "Timers expire on their ticks: " << (check_expiry() ? "yes" : "NO") << "\n\n";
+
+    std::mt19937_64             engine{42};
+    std::vector<std::uint64_t>  delays(timer_count + timer_count / 2);
+    std::vector<size_t>         victims(timer_count / 2);
+
+    for (auto &d : delays)
+        d = 1 + engine() % (max_delay - 1);
+    for (size_t i = 0; i < victims.size(); ++i)
+        victims[i] = 2 * i + engine() % 2;
+
+    std::cout << timer_count << " timers with delays up to " << max_delay
+              << " ticks; half are cancelled and replaced, then all expire\n";
+    std::cout << "                     schedule    cancel  schedule    expire\n";
+
+    {
+        TimingWheel<size_t>                         wheel;
+        std::vector<TimingWheel<size_t>::timer_t *> timers(timer_count);
+        size_t                                      expired{0};
+        auto                                        then{clock_type::now()};
+
+        for (size_t i = 0; i < timer_count; ++i)
+            timers[i] = wheel.schedule(delays[i], i);
+        std::cout << "  TimingWheel:     " << std::setw(8) << elapsed_ms(then) << " ms";
+
+        then = clock_type::now();
+        for (size_t v : victims)
+            wheel.cancel(timers[v]);
+        std::cout << std::setw(7) << elapsed_ms(then) << " ms";
+
+        then = clock_type::now();
+        for (size_t i = timer_count; i < delays.size(); ++i)
+            wheel.schedule(delays[i], i);
+        std::cout << std::setw(7) << elapsed_ms(then) << " ms";
+
+        then = clock_type::now();
+        wheel.advance(max_delay, [&](size_t) { ++expired; });
+        std::cout << std::setw(7) << elapsed_ms(then) << " ms\n";
+
+        if (expired != timer_count)
+            std::cout << "  " << expired << " timers expired!\n";
+    }
+
+    {
+        heap_type                           heap;
+        std::vector<heap_type::node_t *>    timers(timer_count);
+        size_t                              expired{0};
+        auto                                then{clock_type::now()};
+
+        for (size_t i = 0; i < timer_count; ++i)
+            timers[i] = heap.push({delays[i], i});
+        std::cout << "  PairingHeap:     " << std::setw(8) << elapsed_ms(then) << " ms";
+
+        then = clock_type::now();
+        for (size_t v : victims)
+            heap.erase(timers[v]);
+        std::cout << std::setw(7) << elapsed_ms(then) << " ms";
+
+        then = clock_type::now();
+        for (size_t i = timer_count; i < delays.size(); ++i)
+            heap.push({delays[i], i});
+        std::cout << std::setw(7) << elapsed_ms(then) << " ms";
+
+        then = clock_type::now();
+        for (std::uint64_t now = 1; now <= max_delay; ++now)
+        {
+            while (!heap.is_empty() && heap.top().first <= now)
+            {
+                heap.pop();
+                ++expired;
+            }
+        }
+        std::cout << std::setw(7) << elapsed_ms(then) << " ms\n";
+
+        if (expired != timer_count)
+            std::cout << "  " << expired << " timers expired!\n";
+    }
+
+    return 0;
+}